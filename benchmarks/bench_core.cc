@@ -0,0 +1,314 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Local VOTCA includes
+#include "votca/tools/eigen.h"
+#include "votca/tools/elements.h"
+#include "votca/tools/objectfactory.h"
+#include "votca/tools/random.h"
+#include "votca/tools/synchronization.h"
+#include "votca/tools/threadpool.h"
+#include "votca/tools/unitconverter.h"
+
+// Local private VOTCA includes
+#include "benchmark.h"
+
+namespace votca {
+namespace tools {
+namespace benchmark {
+namespace {
+
+const Register random_mt19937(
+    "core/random_mt19937", {1000, 10000000}, [](State& state) {
+      Random random;
+      random.init(20);
+      std::vector<double> values(state.getScale());
+      state.Run(state.getScale(), [&]() {
+        for (double& value : values) {
+          value = random.rand_uniform();
+        }
+        DoNotOptimize(values.data());
+      });
+    });
+
+const Register random_philox(
+    "core/random_philox_fill", {1000, 10000000}, [](State& state) {
+      ParallelRandom random;
+      random.init(20);
+      std::vector<double> values(state.getScale());
+      state.Run(state.getScale(), [&]() {
+        random.FillUniform(values.data(), Index(values.size()));
+        DoNotOptimize(values.data());
+      });
+    });
+
+const Register unit_conversion(
+    "core/unitconverter_bulk", {1000, 10000000, 100000000},
+    [](State& state) {
+      Eigen::VectorXd values = Eigen::VectorXd::Ones(state.getScale());
+      UnitConverter converter;
+      state.setBytesPerIteration(2 * values.size() * Index(sizeof(double)));
+      state.Run(state.getScale(), [&]() {
+        converter.convertInPlace<DistanceUnit, DistanceUnit::nanometers,
+                                 DistanceUnit::angstroms>(values);
+        converter.convertInPlace<DistanceUnit, DistanceUnit::angstroms,
+                                 DistanceUnit::nanometers>(values);
+        DoNotOptimize(values.data());
+      });
+    });
+
+std::vector<double> randomMasses(Index size) {
+  ParallelRandom random;
+  random.init(21);
+  std::vector<double> masses(size);
+  random.FillUniform(masses.data(), Index(masses.size()));
+  for (double& mass : masses) {
+    mass = 1.0 + 200.0 * mass;
+  }
+  return masses;
+}
+
+const Register elements_mass(
+    "core/elements_closest_mass", {1000, 1000000}, [](State& state) {
+      std::vector<double> masses = randomMasses(state.getScale());
+      Elements elements;
+      state.Run(state.getScale(), [&]() {
+        std::vector<Index> numbers =
+            elements.getEleNumClosestInMass(masses, 0.5);
+        DoNotOptimize(numbers.data());
+      });
+    });
+
+const Register elements_mass_per_atom(
+    "core/elements_closest_mass_per_atom", {1000, 1000000},
+    [](State& state) {
+      std::vector<double> masses = randomMasses(state.getScale());
+      Elements elements;
+      state.Run(state.getScale(), [&]() {
+        Index found = 0;
+        for (double mass : masses) {
+          if (elements.isMassAssociatedWithElement(mass, 0.5)) {
+            found += Index(elements.getEleShortClosestInMass(mass, 0.5).size());
+          }
+        }
+        DoNotOptimize(found);
+      });
+    });
+
+// the lookup before the sorted mass index, a linear scan of a map from
+// symbol to mass for every atom
+const Register elements_mass_linear_scan(
+    "core/elements_closest_mass_linear_scan", {1000, 1000000},
+    [](State& state) {
+      std::vector<double> masses = randomMasses(state.getScale());
+      Elements elements;
+      std::map<std::string, double> mass_map;
+      for (Index elenum = 1; elenum <= 86; ++elenum) {
+        try {
+          mass_map[elements.getEleName(elenum)] = elements.getMass(elenum);
+        } catch (const std::runtime_error&) {
+          // no element with this number
+        }
+      }
+      state.Run(state.getScale(), [&]() {
+        Index found = 0;
+        for (double mass : masses) {
+          std::string eleShort = "H";
+          double diff = std::fabs(mass - mass_map[eleShort]);
+          for (const auto& ele_pr : mass_map) {
+            if (std::fabs(ele_pr.second - mass) < diff) {
+              eleShort = ele_pr.first;
+              diff = std::fabs(ele_pr.second - mass);
+            }
+          }
+          if (diff / mass_map[eleShort] <= 0.5) {
+            found += Index(eleShort.size());
+          }
+        }
+        DoNotOptimize(found);
+      });
+    });
+
+const Register parallel_for(
+    "core/threadpool_parallel_for", {1000, 1000000}, [](State& state) {
+      std::vector<double> values(state.getScale(), 1.0);
+      state.Run(state.getScale(), [&]() {
+        ThreadPool::Global().parallel_for(
+            0, state.getScale(), [&](Index i) { values[i] *= 1.000001; });
+        DoNotOptimize(values.data());
+      });
+    });
+
+/**
+ * \brief Registers a contention benchmark for 1, 2, 4 and all threads
+ *
+ * body(state, max_threads) runs its increments with parallel_for on at most
+ * max_threads threads, 0 uses the whole pool. Thread counts above the size
+ * of the pool are capped by parallel_for.
+ */
+void RegisterContention(const std::string& name,
+                        std::function<void(State&, Index)> body) {
+  for (Index nthreads : {1, 2, 4, 0}) {
+    std::string suffix = (nthreads == 0) ? "all" : std::to_string(nthreads);
+    Register(name + "_threads" + suffix, {1000, 1000000},
+             [body, nthreads](State& state) { body(state, nthreads); });
+  }
+}
+
+void atomicIncrements(State& state, Index nthreads) {
+  std::atomic<Index> counter(0);
+  auto increment = [&](Index) {
+    counter.fetch_add(1, std::memory_order_relaxed);
+  };
+  state.Run(state.getScale(), [&]() {
+    ThreadPool::Global().parallel_for(0, state.getScale(), increment, 0,
+                                      nthreads);
+    DoNotOptimize(counter.load());
+  });
+}
+
+void shardedIncrements(State& state, Index nthreads) {
+  ShardedCounter counter;
+  auto increment = [&](Index) { counter.add(); };
+  state.Run(state.getScale(), [&]() {
+    ThreadPool::Global().parallel_for(0, state.getScale(), increment, 0,
+                                      nthreads);
+    DoNotOptimize(counter.value());
+  });
+}
+
+void shardedSums(State& state, Index nthreads) {
+  ShardedAccumulator<double> sum;
+  auto add = [&](Index) { sum.add(1.0); };
+  state.Run(state.getScale(), [&]() {
+    ThreadPool::Global().parallel_for(0, state.getScale(), add, 0, nthreads);
+    DoNotOptimize(sum.value());
+  });
+}
+
+template <class Lockable>
+void lockedIncrements(State& state, Index nthreads) {
+  Lockable lock;
+  Index counter = 0;
+  auto increment = [&](Index) {
+    ScopedLock<Lockable> guard(lock);
+    ++counter;
+  };
+  state.Run(state.getScale(), [&]() {
+    ThreadPool::Global().parallel_for(0, state.getScale(), increment, 0,
+                                      nthreads);
+    DoNotOptimize(counter);
+  });
+}
+
+// mostly readers, every 100th access writes
+void readWriteAccesses(State& state, Index nthreads) {
+  ReadWriteLock lock;
+  Index counter = 0;
+  std::atomic<Index> reads(0);
+  auto access = [&](Index i) {
+    if (i % 100 == 0) {
+      WriteLock guard(lock);
+      ++counter;
+    } else {
+      ReadLock guard(lock);
+      reads.fetch_add(counter, std::memory_order_relaxed);
+    }
+  };
+  state.Run(state.getScale(), [&]() {
+    ThreadPool::Global().parallel_for(0, state.getScale(), access, 0,
+                                      nthreads);
+    DoNotOptimize(reads.load());
+  });
+}
+
+const bool contention = []() {
+  RegisterContention("core/counter_atomic", atomicIncrements);
+  RegisterContention("core/counter_sharded", shardedIncrements);
+  RegisterContention("core/accumulator_sharded", shardedSums);
+  RegisterContention("core/lock_scoped_mutex", lockedIncrements<Mutex>);
+  RegisterContention("core/lock_hybrid", lockedIncrements<HybridLock>);
+  RegisterContention("core/lock_read_write", readWriteAccesses);
+  return true;
+}();
+
+class Calculator {
+ public:
+  virtual ~Calculator() = default;
+  virtual Index Id() const = 0;
+};
+
+template <Index N>
+class NumberedCalculator : public Calculator {
+ public:
+  Index Id() const override { return N; }
+};
+
+const Register factory_create(
+    "core/objectfactory_create", {1000, 100000}, [](State& state) {
+      ObjectFactory<std::string, Calculator> factory;
+      factory.Register<NumberedCalculator<0>>("calculator0");
+      factory.Register<NumberedCalculator<1>>("calculator1");
+      factory.Register<NumberedCalculator<2>>("calculator2");
+      factory.Register<NumberedCalculator<3>>("calculator3");
+      factory.Freeze();
+      const std::vector<std::string> keys = {"calculator0", "calculator1",
+                                             "calculator2", "calculator3"};
+      state.Run(state.getScale(), [&]() {
+        Index sum = 0;
+        for (Index i = 0; i < state.getScale(); ++i) {
+          sum += factory.CreateUnique(keys[i % keys.size()])->Id();
+        }
+        DoNotOptimize(sum);
+      });
+    });
+
+const Register pool_acquire(
+    "core/objectpool_acquire", {1000, 100000}, [](State& state) {
+      ObjectFactory<std::string, Calculator> factory;
+      factory.Register<NumberedCalculator<0>>("calculator0");
+      factory.Register<NumberedCalculator<1>>("calculator1");
+      factory.Register<NumberedCalculator<2>>("calculator2");
+      factory.Register<NumberedCalculator<3>>("calculator3");
+      factory.Freeze();
+      ObjectPool<std::string, Calculator> pool(factory);
+      const std::vector<std::string> keys = {"calculator0", "calculator1",
+                                             "calculator2", "calculator3"};
+      state.Run(state.getScale(), [&]() {
+        Index sum = 0;
+        for (Index i = 0; i < state.getScale(); ++i) {
+          // released again at the end of the statement
+          sum += pool.Acquire(keys[i % keys.size()])->Id();
+        }
+        DoNotOptimize(sum);
+      });
+    });
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace tools
+}  // namespace votca
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Local VOTCA includes
+#include "votca/tools/connectedcomponents.h"
+#include "votca/tools/cyclebasis.h"
+#include "votca/tools/edge.h"
+#include "votca/tools/graph.h"
+#include "votca/tools/graph_bf_visitor.h"
+#include "votca/tools/graphalgorithm.h"
+#include "votca/tools/graphcache.h"
+#include "votca/tools/graphdistances.h"
+#include "votca/tools/graphdistvisitor.h"
+#include "votca/tools/graphnode.h"
+#include "votca/tools/random.h"
+#include "votca/tools/reducedgraph.h"
+
+// Local private VOTCA includes
+#include "benchmark.h"
+
+namespace votca {
+namespace tools {
+namespace benchmark {
+namespace {
+
+// Every graph is built from a fixed seed, so all runs see the same input
+std::vector<Edge> randomEdges(Index vertices, Index edges, Index seed) {
+  ParallelRandom random;
+  random.init(seed);
+  std::vector<Edge> result;
+  result.reserve(edges);
+  while (Index(result.size()) < edges) {
+    Index v1 = Index(random.rand_uniform() * double(vertices));
+    Index v2 = Index(random.rand_uniform() * double(vertices));
+    if (v1 != v2) {
+      result.emplace_back(v1, v2);
+    }
+  }
+  return result;
+}
+
+// 0 - 1 - 2 - ... - n-1
+std::vector<Edge> chainEdges(Index vertices) {
+  std::vector<Edge> result;
+  result.reserve(vertices);
+  for (Index i = 1; i < vertices; ++i) {
+    result.emplace_back(i - 1, i);
+  }
+  return result;
+}
+
+// Backbone chain with a side chain of three vertices at every tenth vertex,
+// similar to a coarse grained polymer
+std::vector<Edge> polymerEdges(Index backbone) {
+  std::vector<Edge> result = chainEdges(backbone);
+  Index next = backbone;
+  for (Index i = 0; i < backbone; i += 10) {
+    result.emplace_back(i, next);
+    result.emplace_back(next, next + 1);
+    result.emplace_back(next + 1, next + 2);
+    next += 3;
+  }
+  return result;
+}
+
+// Ladder of fused rings, like a polyacene
+std::vector<Edge> ladderEdges(Index rings) {
+  std::vector<Edge> result;
+  for (Index i = 0; i <= rings; ++i) {
+    result.emplace_back(2 * i, 2 * i + 1);
+    if (i > 0) {
+      result.emplace_back(2 * i - 2, 2 * i);
+      result.emplace_back(2 * i - 1, 2 * i + 1);
+    }
+  }
+  return result;
+}
+
+Graph makeGraph(const std::vector<Edge>& edges) {
+  std::unordered_map<Index, GraphNode> nodes;
+  for (const Edge& edge : edges) {
+    nodes[edge.getEndPoint1()] = GraphNode();
+    nodes[edge.getEndPoint2()] = GraphNode();
+  }
+  return Graph(edges, nodes);
+}
+
+const Register edge_hash(
+    "graph/edge_hash", {1000, 100000, 1000000}, [](State& state) {
+      std::vector<Edge> edges =
+          randomEdges(state.getScale(), state.getScale(), 1);
+      state.Run(state.getScale(), [&]() {
+        std::unordered_set<Edge> set;
+        set.reserve(edges.size());
+        set.insert(edges.begin(), edges.end());
+        DoNotOptimize(set.size());
+      });
+    });
+
+const Register connected_components(
+    "graph/connected_components", {1000, 100000, 1000000}, [](State& state) {
+      // below the percolation threshold, many components of varying size
+      Graph graph = makeGraph(
+          randomEdges(state.getScale(), state.getScale() / 2, 2));
+      state.Run(state.getScale(), [&]() {
+        ConnectedComponents components(graph);
+        DoNotOptimize(components.size());
+      });
+    });
+
+// A Graph of 10^7 vertices does not fit in memory next to its nodes, so the
+// largest scale labels the bare edge list
+const Register connected_components_edges(
+    "graph/connected_components_edges", {1000, 100000, 1000000, 10000000},
+    [](State& state) {
+      std::vector<Index> vertices(state.getScale());
+      std::iota(vertices.begin(), vertices.end(), Index(0));
+      std::vector<Edge> edges =
+          randomEdges(state.getScale(), state.getScale() / 2, 2);
+      state.Run(state.getScale(), [&]() {
+        ConnectedComponents components(vertices, edges);
+        DoNotOptimize(components.size());
+      });
+    });
+
+const Register cycle_basis(
+    "graph/cycle_basis", {10, 100, 1000, 10000}, [](State& state) {
+      Graph graph = makeGraph(ladderEdges(state.getScale()));
+      state.Run(state.getScale(), [&]() {
+        std::vector<std::vector<Index>> rings = findMinimumCycleBasis(graph);
+        DoNotOptimize(rings.size());
+      });
+    });
+
+const Register explore_bf(
+    "graph/explore_bf", {1000, 100000, 1000000}, [](State& state) {
+      Graph graph = makeGraph(polymerEdges(state.getScale()));
+      state.Run(state.getScale(), [&]() {
+        Graph_BF_Visitor visitor;
+        exploreGraph(graph, visitor);
+        DoNotOptimize(visitor.getExploredCount());
+      });
+    });
+
+// labels every vertex with its distance from vertex 0, the time per vertex
+// should not grow with the size of the graph
+const Register dist_visitor(
+    "graph/dist_visitor", {1000, 100000, 1000000}, [](State& state) {
+      Graph graph = makeGraph(polymerEdges(state.getScale()));
+      Index vertices = Index(graph.getVertices().size());
+      state.Run(vertices, [&]() {
+        GraphDistVisitor visitor;
+        exploreGraph(graph, visitor);
+        DoNotOptimize(visitor.getExploredCount());
+      });
+    });
+
+const Register distances(
+    "graph/distances", {1000, 100000}, [](State& state) {
+      Graph graph = makeGraph(
+          randomEdges(state.getScale(), 2 * state.getScale(), 3));
+      GraphDistances graph_distances(graph);
+      state.Run(state.getScale(), [&]() {
+        std::vector<std::vector<GraphDistances::Neighbor>> neighbors =
+            graph_distances.AllNeighbors(2);
+        DoNotOptimize(neighbors.size());
+      });
+    });
+
+const Register reduce(
+    "graph/reduce", {1000, 100000, 1000000}, [](State& state) {
+      Graph graph = makeGraph(polymerEdges(state.getScale()));
+      state.Run(state.getScale(), [&]() {
+        ReducedGraph reduced = reduceGraph(graph);
+        DoNotOptimize(reduced.getEdges().size());
+      });
+    });
+
+const Register serialize(
+    "graph/serialize", {1000, 100000}, [](State& state) {
+      Graph graph = makeGraph(polymerEdges(state.getScale()));
+      std::vector<char> buffer;
+      GraphSerializer::Write(graph, buffer);
+      state.setBytesPerIteration(2 * Index(buffer.size()));
+      state.Run(state.getScale(), [&]() {
+        buffer.clear();
+        GraphSerializer::Write(graph, buffer);
+        const char* data = buffer.data();
+        Graph copy;
+        GraphSerializer::Read(data, data + buffer.size(), copy);
+        DoNotOptimize(copy.getId());
+      });
+    });
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace tools
+}  // namespace votca
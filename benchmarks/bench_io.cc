@@ -0,0 +1,197 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Third party includes
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/eigen.h"
+#include "votca/tools/eigenio_matrixmarket.h"
+#include "votca/tools/lexical_cast.h"
+#include "votca/tools/property.h"
+#include "votca/tools/random.h"
+#include "votca/tools/table.h"
+#include "votca/tools/tokenizer.h"
+
+// Local private VOTCA includes
+#include "benchmark.h"
+
+namespace votca {
+namespace tools {
+namespace benchmark {
+namespace {
+
+// File in the temporary directory which is removed with the object
+class TempFile {
+ public:
+  explicit TempFile(const std::string& extension)
+      : path_(boost::filesystem::temp_directory_path() /
+              boost::filesystem::unique_path("votca_benchmark_%%%%%%%%" +
+                                             extension)) {}
+  ~TempFile() {
+    boost::system::error_code ec;
+    boost::filesystem::remove(path_, ec);
+  }
+  std::string name() const { return path_.string(); }
+  Index size() const { return Index(boost::filesystem::file_size(path_)); }
+
+ private:
+  boost::filesystem::path path_;
+};
+
+// Topology like options file with scale atoms in molecules of 10 atoms
+void writePropertyFile(const std::string& filename, Index atoms) {
+  std::ofstream out(filename);
+  out << "<topology>\n  <molecules>\n";
+  for (Index atom = 0; atom < atoms; ++atom) {
+    if (atom % 10 == 0) {
+      out << "    <molecule>\n      <name>mol" << atom / 10 << "</name>\n";
+    }
+    out << boost::format(
+               "      <atom type=\"C\">\n        <id>%1%</id>\n        "
+               "<pos>%2% %3% %4%</pos>\n      </atom>\n") %
+               atom % (0.1 * double(atom)) % (0.2 * double(atom)) %
+               (0.3 * double(atom));
+    if (atom % 10 == 9 || atom + 1 == atoms) {
+      out << "    </molecule>\n";
+    }
+  }
+  out << "  </molecules>\n</topology>\n";
+}
+
+const Register property_load(
+    "io/property_load_xml", {1000, 100000}, [](State& state) {
+      TempFile file(".xml");
+      writePropertyFile(file.name(), state.getScale());
+      state.setBytesPerIteration(file.size());
+      state.Run(state.getScale(), [&]() {
+        Property property;
+        property.LoadFromXML(file.name());
+        DoNotOptimize(property.size());
+      });
+    });
+
+const Register property_select(
+    "io/property_select", {1000, 100000}, [](State& state) {
+      TempFile file(".xml");
+      writePropertyFile(file.name(), state.getScale());
+      Property property;
+      property.LoadFromXML(file.name());
+      state.Run(state.getScale(), [&]() {
+        double sum = 0.0;
+        for (const Property* molecule :
+             property.Select("topology.molecules.molecule")) {
+          for (const Property* atom : molecule->Select("atom")) {
+            sum += atom->get("pos").as<Eigen::Vector3d>().x();
+          }
+        }
+        DoNotOptimize(sum);
+      });
+    });
+
+Table randomTable(Index rows) {
+  ParallelRandom random;
+  random.init(4);
+  Table table;
+  table.resize(rows);
+  for (Index i = 0; i < rows; ++i) {
+    table.set(i, 0.01 * double(i), random.rand_normal());
+  }
+  return table;
+}
+
+const Register table_save(
+    "io/table_save", {1000, 100000}, [](State& state) {
+      TempFile file(".dat");
+      Table table = randomTable(state.getScale());
+      table.Save(file.name());
+      state.setBytesPerIteration(file.size());
+      state.Run(state.getScale(), [&]() { table.Save(file.name()); });
+    });
+
+const Register table_load(
+    "io/table_load", {1000, 100000}, [](State& state) {
+      TempFile file(".dat");
+      randomTable(state.getScale()).Save(file.name());
+      state.setBytesPerIteration(file.size());
+      state.Run(state.getScale(), [&]() {
+        Table table;
+        table.Load(file.name());
+        DoNotOptimize(table.size());
+      });
+    });
+
+const Register matrixmarket(
+    "io/matrixmarket_roundtrip", {100, 1000}, [](State& state) {
+      TempFile file(".mm");
+      ParallelRandom random;
+      random.init(5);
+      Eigen::MatrixXd matrix(state.getScale(), state.getScale());
+      random.FillUniform(matrix);
+      EigenIO_MatrixMarket::WriteMatrix(file.name(), matrix);
+      state.setBytesPerIteration(2 * file.size());
+      state.Run(matrix.size(), [&]() {
+        EigenIO_MatrixMarket::WriteMatrix(file.name(), matrix);
+        Eigen::MatrixXd read = EigenIO_MatrixMarket::ReadMatrix(file.name());
+        DoNotOptimize(read(0, 0));
+      });
+    });
+
+const Register tokenize(
+    "io/tokenize_doubles", {1000, 1000000}, [](State& state) {
+      ParallelRandom random;
+      random.init(6);
+      std::string text;
+      for (Index i = 0; i < state.getScale(); ++i) {
+        text += (boost::format("%.8g") % random.rand_normal()).str();
+        text += (i % 8 == 7) ? "\n" : " \t";
+      }
+      state.setBytesPerIteration(Index(text.size()));
+      std::vector<double> values;
+      state.Run(state.getScale(), [&]() {
+        values.clear();
+        TokenizerView(text, " \t\n").ConvertToVector(values);
+        DoNotOptimize(values.data());
+      });
+    });
+
+const Register lexical(
+    "io/lexical_cast_double", {1000, 1000000}, [](State& state) {
+      std::vector<std::string> words;
+      words.reserve(state.getScale());
+      for (Index i = 0; i < state.getScale(); ++i) {
+        words.push_back((boost::format("%.12g") % (1e-3 * double(i))).str());
+      }
+      state.Run(state.getScale(), [&]() {
+        double sum = 0.0;
+        for (const std::string& word : words) {
+          sum += lexical_cast<double>(word, "benchmark");
+        }
+        DoNotOptimize(sum);
+      });
+    });
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace tools
+}  // namespace votca
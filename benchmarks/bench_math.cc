@@ -0,0 +1,147 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <vector>
+
+// Local VOTCA includes
+#include "votca/tools/correlate.h"
+#include "votca/tools/cubicspline.h"
+#include "votca/tools/datacollection.h"
+#include "votca/tools/eigen.h"
+#include "votca/tools/histogramnew.h"
+#include "votca/tools/linalg.h"
+#include "votca/tools/random.h"
+
+// Local private VOTCA includes
+#include "benchmark.h"
+
+namespace votca {
+namespace tools {
+namespace benchmark {
+namespace {
+
+// Noisy samples of sin(x) on [0,10]
+void noisySine(Index size, Eigen::VectorXd& x, Eigen::VectorXd& y) {
+  ParallelRandom random;
+  random.init(10);
+  x = Eigen::VectorXd::LinSpaced(size, 0.0, 10.0);
+  y.resize(size);
+  random.FillNormal(y);
+  y = 0.05 * y + x.array().sin().matrix();
+}
+
+const Register spline_fit(
+    "math/cubicspline_fit", {1000, 10000}, [](State& state) {
+      Eigen::VectorXd x, y;
+      noisySine(state.getScale(), x, y);
+      state.Run(state.getScale(), [&]() {
+        CubicSpline spline;
+        spline.setBCInt(0);
+        spline.GenerateGrid(0.0, 10.0, 0.2);
+        spline.Fit(x, y);
+        DoNotOptimize(spline.Calculate(5.0));
+      });
+    });
+
+const Register spline_calculate(
+    "math/cubicspline_calculate", {1000, 1000000}, [](State& state) {
+      Eigen::VectorXd x, y;
+      noisySine(1000, x, y);
+      CubicSpline spline;
+      spline.setBCInt(0);
+      spline.GenerateGrid(0.0, 10.0, 0.2);
+      spline.Fit(x, y);
+      Eigen::VectorXd points =
+          Eigen::VectorXd::LinSpaced(state.getScale(), 0.0, 10.0);
+      state.Run(state.getScale(), [&]() {
+        Eigen::VectorXd values = spline.Calculate(points);
+        DoNotOptimize(values.data());
+      });
+    });
+
+const Register histogram(
+    "math/histogram_process", {1000, 1000000}, [](State& state) {
+      ParallelRandom random;
+      random.init(11);
+      std::vector<double> values(state.getScale());
+      random.FillNormal(values.data(), Index(values.size()));
+      state.Run(state.getScale(), [&]() {
+        HistogramNew hist;
+        hist.Initialize(-5.0, 5.0, 200);
+        hist.ProcessRange<std::vector<double>::iterator>(values.begin(),
+                                                         values.end());
+        DoNotOptimize(hist.data().y().sum());
+      });
+    });
+
+const Register correlate(
+    "math/correlate", {1000, 1000000}, [](State& state) {
+      const Index series = 16;
+      ParallelRandom random;
+      random.init(12);
+      DataCollection<double> data;
+      DataCollection<double>::selection selection;
+      for (Index i = 0; i < series; ++i) {
+        DataCollection<double>::array* array =
+            data.CreateArray("series" + std::to_string(i));
+        array->resize(state.getScale());
+        random.FillNormal(array->data(), state.getScale());
+        selection.push_back(array);
+      }
+      state.Run(series * state.getScale(), [&]() {
+        Correlate correlation;
+        correlation.CalcCorrelations(selection);
+        DoNotOptimize(correlation.getData().data());
+      });
+    });
+
+Eigen::MatrixXd randomSymmetric(Index size) {
+  ParallelRandom random;
+  random.init(13);
+  Eigen::MatrixXd matrix(size, size);
+  random.FillUniform(matrix);
+  return 0.5 * (matrix + matrix.transpose());
+}
+
+// Both solvers run on one thread, Eigen::SelfAdjointEigenSolver is serial
+// without OpenMP. The sizes are above the size at which linalg_eigenvalues
+// switches from the full solver to Lanczos.
+const Register lanczos(
+    "math/lanczos_lowest10", {1000, 2000}, [](State& state) {
+      Eigen::MatrixXd matrix = randomSymmetric(state.getScale());
+      DenseOperator op(matrix, 1);
+      state.Run(state.getScale(), [&]() {
+        EigenSystem result = linalg_lanczos_eigenvalues(op, 10);
+        DoNotOptimize(result.eigenvalues()(0));
+      });
+    });
+
+const Register full_solver(
+    "math/eigensolver_full_lowest10", {1000, 2000}, [](State& state) {
+      Eigen::MatrixXd matrix = randomSymmetric(state.getScale());
+      state.Run(state.getScale(), [&]() {
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(matrix);
+        Eigen::VectorXd lowest = es.eigenvalues().head(10);
+        DoNotOptimize(lowest(0));
+      });
+    });
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace tools
+}  // namespace votca
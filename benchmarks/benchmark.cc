@@ -0,0 +1,262 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+// Third party includes
+#include <boost/format.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/threadpool.h"
+#include "votca/tools/version.h"
+
+// Local private VOTCA includes
+#include "benchmark.h"
+
+#ifdef __unix__
+#include <sys/resource.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifndef VOTCA_BENCHMARK_BUILD_TYPE
+#define VOTCA_BENCHMARK_BUILD_TYPE ""
+#endif
+
+namespace votca {
+namespace tools {
+namespace benchmark {
+
+std::vector<Benchmark>& Registry() {
+  static std::vector<Benchmark> registry;
+  return registry;
+}
+
+namespace {
+
+// Value in kB of a field like "VmHWM:    1234 kB" in /proc/self/status, or
+// -1 on systems without procfs
+Index readStatusField(const std::string& field) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, field.size(), field) == 0 &&
+        line.size() > field.size() && line[field.size()] == ':') {
+      return std::stol(line.substr(field.size() + 1));
+    }
+  }
+  return -1;
+}
+
+// Hands memory freed by earlier benchmarks back to the system, otherwise it
+// stays resident and hides the peak of the next benchmark
+void releaseFreeMemory() {
+#ifdef __GLIBC__
+  malloc_trim(0);
+#endif
+}
+
+// Linux resets the peak resident set size to the current one if 5 is
+// written to clear_refs
+bool resetPeakRSS() {
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  if (!clear_refs) {
+    return false;
+  }
+  clear_refs << "5";
+  clear_refs.close();
+  return bool(clear_refs);
+}
+
+Index peakRSS() {
+  Index peak = readStatusField("VmHWM");
+  if (peak >= 0) {
+    return peak;
+  }
+#ifdef __unix__
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    return Index(usage.ru_maxrss);
+  }
+#endif
+  return 0;
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+  // nearest rank
+  Index rank = Index(std::ceil(fraction * double(sorted.size())));
+  rank = std::min(std::max(rank, Index(1)), Index(sorted.size()));
+  return sorted[rank - 1];
+}
+
+std::string escapeJSON(const std::string& text) {
+  std::string escaped;
+  for (char c : text) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          escaped += (boost::format("\\u%04x") % int(c)).str();
+        } else {
+          escaped += c;
+        }
+    }
+  }
+  return escaped;
+}
+
+std::string currentTime() {
+  std::time_t now = std::time(nullptr);
+  char buffer[32];
+  std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ",
+                std::gmtime(&now));
+  return buffer;
+}
+
+}  // namespace
+
+Result RunBenchmark(const Benchmark& benchmark, Index scale,
+                    const Settings& settings) {
+  Result result;
+  result.name = benchmark.name;
+  result.scale = scale;
+  releaseFreeMemory();
+  result.rss_before_kb = readStatusField("VmRSS");
+  result.peak_rss_is_local = resetPeakRSS();
+
+  {
+    State state(scale, settings);
+    benchmark.function(state);
+
+    std::vector<double> latencies = state.getLatencies();
+    if (latencies.empty()) {
+      throw std::runtime_error("Benchmark " + benchmark.name +
+                               " never called State::Run");
+    }
+    std::sort(latencies.begin(), latencies.end());
+    result.iterations = Index(latencies.size());
+    result.items_per_iteration = state.getItemsPerIteration();
+    result.bytes_per_iteration = state.getBytesPerIteration();
+    for (double t : latencies) {
+      result.total_time += t;
+    }
+    result.mean = result.total_time / double(result.iterations);
+    double variance = 0.0;
+    for (double t : latencies) {
+      variance += (t - result.mean) * (t - result.mean);
+    }
+    result.stddev = std::sqrt(variance / double(result.iterations));
+    result.min = latencies.front();
+    result.max = latencies.back();
+    result.p50 = percentile(latencies, 0.50);
+    result.p90 = percentile(latencies, 0.90);
+    result.p99 = percentile(latencies, 0.99);
+    if (result.total_time > 0.0) {
+      double calls = double(result.iterations) / result.total_time;
+      result.items_per_second = double(result.items_per_iteration) * calls;
+      result.bytes_per_second = double(result.bytes_per_iteration) * calls;
+    }
+  }
+  result.peak_rss_kb = peakRSS();
+  return result;
+}
+
+void WriteJSON(std::ostream& out, const std::vector<Result>& results) {
+  out << std::setprecision(9);
+  out << "{\n";
+  out << "  \"context\": {\n";
+  out << "    \"date\": \"" << currentTime() << "\",\n";
+  out << "    \"votca_tools_version\": \"" << escapeJSON(ToolsVersionStr())
+      << "\",\n";
+  out << "    \"build_type\": \"" << escapeJSON(VOTCA_BENCHMARK_BUILD_TYPE)
+      << "\",\n";
+#if defined(__VERSION__)
+  out << "    \"compiler\": \"" << escapeJSON(__VERSION__) << "\",\n";
+#endif
+  out << "    \"threads\": " << ThreadPool::Global().size() << ",\n";
+  out << "    \"hardware_concurrency\": "
+      << std::thread::hardware_concurrency() << "\n";
+  out << "  },\n";
+  out << "  \"benchmarks\": [";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const Result& r = results[i];
+    out << (i == 0 ? "\n" : ",\n");
+    out << "    {\n";
+    out << "      \"name\": \"" << escapeJSON(r.name) << "\",\n";
+    out << "      \"scale\": " << r.scale << ",\n";
+    out << "      \"iterations\": " << r.iterations << ",\n";
+    out << "      \"items_per_iteration\": " << r.items_per_iteration << ",\n";
+    out << "      \"bytes_per_iteration\": " << r.bytes_per_iteration << ",\n";
+    out << "      \"items_per_second\": " << r.items_per_second << ",\n";
+    out << "      \"bytes_per_second\": " << r.bytes_per_second << ",\n";
+    out << "      \"latency\": {\n";
+    out << "        \"unit\": \"s\",\n";
+    out << "        \"mean\": " << r.mean << ",\n";
+    out << "        \"stddev\": " << r.stddev << ",\n";
+    out << "        \"min\": " << r.min << ",\n";
+    out << "        \"p50\": " << r.p50 << ",\n";
+    out << "        \"p90\": " << r.p90 << ",\n";
+    out << "        \"p99\": " << r.p99 << ",\n";
+    out << "        \"max\": " << r.max << "\n";
+    out << "      },\n";
+    out << "      \"memory\": {\n";
+    out << "        \"rss_before_kb\": " << r.rss_before_kb << ",\n";
+    out << "        \"peak_rss_kb\": " << r.peak_rss_kb << ",\n";
+    out << "        \"peak_rss_is_local\": "
+        << (r.peak_rss_is_local ? "true" : "false") << "\n";
+    out << "      }\n";
+    out << "    }";
+  }
+  out << "\n  ]\n";
+  out << "}\n";
+}
+
+void PrintTable(std::ostream& out, const std::vector<Result>& results) {
+  boost::format line("%|-36| %|10| %|8| %|12| %|12| %|12| %|14| %|10|\n");
+  out << line % "benchmark" % "scale" % "iter" % "p50 [us]" % "p90 [us]" %
+             "p99 [us]" % "items/s" % "peak [MB]";
+  for (const Result& r : results) {
+    out << line % r.name % r.scale % r.iterations %
+               (boost::format("%.2f") % (r.p50 * 1e6)) %
+               (boost::format("%.2f") % (r.p90 * 1e6)) %
+               (boost::format("%.2f") % (r.p99 * 1e6)) %
+               (boost::format("%.4g") % r.items_per_second) %
+               (boost::format("%.1f") % (double(r.peak_rss_kb) / 1024.0));
+  }
+}
+
+}  // namespace benchmark
+}  // namespace tools
+}  // namespace votca
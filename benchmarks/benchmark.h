@@ -0,0 +1,169 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_BENCHMARK_H
+#define VOTCA_TOOLS_BENCHMARK_H
+
+// Standard includes
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Local VOTCA includes
+#include "votca/tools/types.h"
+
+namespace votca {
+namespace tools {
+namespace benchmark {
+
+/// Keeps the compiler from discarding a result which is never used
+template <class T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+/// Settings which control how often the body of a benchmark is repeated
+struct Settings {
+  double min_time = 0.5;
+  Index min_iterations = 5;
+  Index max_iterations = 100000;
+};
+
+/**
+ * \brief Handed to every benchmark, times the repeated body
+ *
+ * A benchmark builds its input for getScale() first, which is not timed,
+ * and then passes the hot loop to Run. Every call of the body is timed on
+ * its own, so that latency percentiles can be reported. Bodies should run
+ * for at least several microseconds, very short operations have to be
+ * batched inside the body.
+ */
+class State {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  State(Index scale, const Settings& settings)
+      : scale_(scale), settings_(settings) {}
+
+  Index getScale() const { return scale_; }
+
+  /// Calls body once untimed and then repeatedly until the time and
+  /// iteration limits are met, every call processes items items
+  template <class Body>
+  void Run(Index items, Body&& body) {
+    items_ = items;
+    body();
+    latencies_.clear();
+    double total = 0.0;
+    while (Index(latencies_.size()) < settings_.max_iterations &&
+           (Index(latencies_.size()) < settings_.min_iterations ||
+            total < settings_.min_time)) {
+      Clock::time_point start = Clock::now();
+      body();
+      Clock::time_point stop = Clock::now();
+      double seconds = std::chrono::duration<double>(stop - start).count();
+      latencies_.push_back(seconds);
+      total += seconds;
+    }
+  }
+
+  /// Bytes read or written by one call of the body, optional
+  void setBytesPerIteration(Index bytes) { bytes_ = bytes; }
+
+  Index getItemsPerIteration() const { return items_; }
+  Index getBytesPerIteration() const { return bytes_; }
+  const std::vector<double>& getLatencies() const { return latencies_; }
+
+ private:
+  Index scale_;
+  Settings settings_;
+  Index items_ = 0;
+  Index bytes_ = 0;
+  std::vector<double> latencies_;
+};
+
+struct Benchmark {
+  std::string name;
+  std::vector<Index> scales;
+  std::function<void(State&)> function;
+};
+
+/// All benchmarks registered in the executable
+std::vector<Benchmark>& Registry();
+
+/**
+ * \brief Adds a benchmark to the Registry during static initialization
+ *
+ * Every source file of the benchmark executable defines its benchmarks as
+ * static Register objects, the scales are the input sizes the benchmark is
+ * run with.
+ */
+class Register {
+ public:
+  Register(std::string name, std::vector<Index> scales,
+           std::function<void(State&)> function) {
+    Registry().push_back({std::move(name), std::move(scales),
+                          std::move(function)});
+  }
+};
+
+/// Statistics of one benchmark at one scale, times are in seconds
+struct Result {
+  std::string name;
+  Index scale = 0;
+  Index iterations = 0;
+  Index items_per_iteration = 0;
+  Index bytes_per_iteration = 0;
+  double total_time = 0.0;
+  double mean = 0.0;
+  double stddev = 0.0;
+  double min = 0.0;
+  double max = 0.0;
+  double p50 = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+  double items_per_second = 0.0;
+  double bytes_per_second = 0.0;
+  /// resident memory before the benchmark and the peak during it in kB
+  Index rss_before_kb = 0;
+  Index peak_rss_kb = 0;
+  /// false if the peak could not be reset and covers the whole process
+  bool peak_rss_is_local = false;
+};
+
+/// Builds the input of benchmark at scale and measures it
+Result RunBenchmark(const Benchmark& benchmark, Index scale,
+                    const Settings& settings);
+
+/// Writes results and the build context as a JSON document
+void WriteJSON(std::ostream& out, const std::vector<Result>& results);
+
+/// Prints one line per result in a human readable table
+void PrintTable(std::ostream& out, const std::vector<Result>& results);
+
+}  // namespace benchmark
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_BENCHMARK_H
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <regex>
+
+// Third party includes
+#include <boost/program_options.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/application.h"
+
+// Local private VOTCA includes
+#include "benchmark.h"
+
+using namespace std;
+using namespace votca::tools;
+namespace po = boost::program_options;
+
+class VotcaBenchmark : public Application {
+
+ public:
+  string ProgramName() override { return "votca_benchmark"; }
+
+  void HelpText(ostream& out) override {
+    out << "Runs the libtools benchmarks on synthetic inputs of several "
+           "sizes.\nResults can be written as JSON and compared with "
+           "votca_benchmark_compare.";
+  }
+
+  void Initialize() override {
+    AddProgramOptions()("filter", po::value<string>()->default_value(".*"),
+                        "regular expression matched against name/scale")(
+        "list", "list the benchmarks and their scales and exit")(
+        "out", po::value<string>(), "write the results as JSON to this file")(
+        "min-time", po::value<double>()->default_value(0.5),
+        "minimal measured time per benchmark in seconds")(
+        "min-iterations", po::value<votca::Index>()->default_value(5),
+        "minimal number of timed iterations")(
+        "max-iterations", po::value<votca::Index>()->default_value(100000),
+        "maximal number of timed iterations")(
+        "max-scale", po::value<votca::Index>(),
+        "skip scales larger than this, e.g. for a quick check");
+  }
+
+  bool EvaluateOptions() override { return true; }
+
+  void Run() override {
+    using namespace votca::tools::benchmark;
+    vector<Benchmark>& benchmarks = Registry();
+    std::sort(benchmarks.begin(), benchmarks.end(),
+              [](const Benchmark& a, const Benchmark& b) {
+                return a.name < b.name;
+              });
+
+    Settings settings;
+    settings.min_time = _op_vm["min-time"].as<double>();
+    settings.min_iterations = _op_vm["min-iterations"].as<votca::Index>();
+    settings.max_iterations = _op_vm["max-iterations"].as<votca::Index>();
+    if (settings.max_iterations < 1 ||
+        settings.min_iterations > settings.max_iterations) {
+      throw runtime_error(
+          "max-iterations has to be positive and at least min-iterations");
+    }
+    regex filter(_op_vm["filter"].as<string>());
+
+    vector<Result> results;
+    for (const Benchmark& bench : benchmarks) {
+      for (votca::Index scale : bench.scales) {
+        if (_op_vm.count("max-scale") &&
+            scale > _op_vm["max-scale"].as<votca::Index>()) {
+          continue;
+        }
+        string id = bench.name + "/" + to_string(scale);
+        if (!regex_search(id, filter)) {
+          continue;
+        }
+        if (_op_vm.count("list")) {
+          cout << id << "\n";
+          continue;
+        }
+        cout << "running " << id << endl;
+        results.push_back(RunBenchmark(bench, scale, settings));
+      }
+    }
+    if (_op_vm.count("list")) {
+      return;
+    }
+
+    cout << "\n";
+    PrintTable(cout, results);
+
+    if (_op_vm.count("out")) {
+      string filename = _op_vm["out"].as<string>();
+      ofstream out(filename);
+      if (!out) {
+        throw runtime_error("Could not open " + filename + " for writing");
+      }
+      WriteJSON(out, results);
+    }
+  }
+};
+
+int main(int argc, char** argv) {
+  VotcaBenchmark vb;
+  return vb.Exec(argc, argv);
+}
@@ -169,6 +169,12 @@ class Application {
   /// get input parameters from file, location may be specified in command line
   void ParseCommandLine(int argc, char **argv);
 
+  /// write the summary or trace requested with --profile
+  void WriteProfile();
+
+  /// "summary" or the trace file given with --profile, empty if not profiling
+  std::string _profile_output;
+
   /// program options without the Hidden group
   boost::program_options::options_description _visible_options;
 };
@@ -22,8 +22,10 @@
 
 // Local VOTCA includes
 #include "globals.h"
+#include "optionsbinder.h"
 #include "property.h"
 #include "propertyiomanipulator.h"
+#include "threadpool.h"
 
 namespace votca {
 namespace tools {
@@ -63,7 +65,9 @@ class Calculator {
   /**
    * \brief Sets number of threads to use
    *
-   * If only one thread is used, this calculator behaves as a master
+   * If only one thread is used, this calculator behaves as a master.
+   * The setting only applies to this calculator, see parallel_for, the
+   * shared ThreadPool::Global() keeps its size.
    *
    * @param nThreads number of threads running this calculator
    *
@@ -72,6 +76,20 @@ class Calculator {
     _nThreads = nThreads;
     _maverick = (_nThreads == 1) ? true : false;
   }
+
+  /**
+   * \brief Thread pool to be used for parallel work of the calculator
+   */
+  ThreadPool &getThreadPool() const { return ThreadPool::Global(); }
+
+  /**
+   * \brief Calls f(i) for every i in [begin,end) on getThreadPool() with at
+   * most the number of threads given to setnThreads
+   */
+  template <class F>
+  void parallel_for(Index begin, Index end, F f) const {
+    getThreadPool().parallel_for(begin, end, f, 0, _nThreads);
+  }
   /**
    * \brief Outputs all options of a calculator
    *
@@ -110,8 +128,25 @@ class Calculator {
     return defaults;
   }
 
+  /**
+   * \brief Load the options as above and convert them into a struct
+   *
+   * Meant to be called once in Initialize, afterwards the calculator reads
+   * the validated and converted struct fields. Every key of the binder has
+   * to be part of the default options.
+   */
+  template <typename Options>
+  Options LoadOptions(const std::string package, const Property &user_options,
+                      const OptionsBinder<Options> &binder) {
+    Property options =
+        LoadDefaultsAndUpdateWithUserOptions(package, user_options);
+    binder.CheckKeys(options);
+    return binder.Parse(options);
+  }
+
  protected:
-  Index _nThreads;
+  // 0 uses all threads of the pool
+  Index _nThreads = 0;
   bool _maverick;
 
   void OverwriteDefaultsWithUserInput(const Property &p, Property &defaults);
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_CONNECTEDCOMPONENTS_H
+#define VOTCA_TOOLS_CONNECTEDCOMPONENTS_H
+
+// Standard includes
+#include <unordered_map>
+#include <vector>
+
+// Third party includes
+#include <boost/range/iterator_range.hpp>
+
+// Local VOTCA includes
+#include "edge.h"
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+class Graph;
+class ConnectedComponents;
+
+/**
+ * \brief Read only view of one connected component
+ *
+ * The view refers to the vertex and edge arrays owned by the
+ * ConnectedComponents instance it was obtained from, no vertices or edges are
+ * copied. It is only valid as long as that instance is alive.
+ */
+class SubGraphView {
+ public:
+  using VertexRange = boost::iterator_range<std::vector<Index>::const_iterator>;
+  using EdgeRange = boost::iterator_range<std::vector<Edge>::const_iterator>;
+
+  /// Id of the component, components are numbered by their smallest vertex
+  Index getComponent() const { return component_; }
+  /// Vertices of the component in ascending order
+  VertexRange getVertices() const;
+  /// Edges of the component
+  EdgeRange getEdges() const;
+  /// Number of vertices in the component
+  Index size() const { return Index(getVertices().size()); }
+
+  /// Builds a stand alone graph of the component, the nodes are copied from
+  /// graph
+  Graph toGraph(const Graph& graph) const;
+
+ private:
+  friend class ConnectedComponents;
+  SubGraphView(const ConnectedComponents& components, Index component)
+      : components_(&components), component_(component) {}
+
+  const ConnectedComponents* components_;
+  Index component_;
+};
+
+/**
+ * \brief Labels the connected components of a graph
+ *
+ * The components are found with a union find structure over the edge list in
+ * a single pass. Roots are always linked to the smaller of the two vertices
+ * with an atomic compare and swap, so for large edge lists the pass can be
+ * split over the global ThreadPool without locks. The result does not depend
+ * on the number of threads: components are numbered in order of their
+ * smallest vertex id.
+ */
+class ConnectedComponents {
+ public:
+  explicit ConnectedComponents(const Graph& graph, bool parallel = true);
+  ConnectedComponents(std::vector<Index> vertices,
+                      const std::vector<Edge>& edges, bool parallel = true);
+
+  /// Number of components
+  Index size() const { return Index(vertex_offsets_.size()) - 1; }
+
+  /// Component id of a vertex
+  Index getComponent(Index vertex) const;
+
+  /// Component id of every vertex, in the order of getVertices()
+  const std::vector<Index>& getComponentIds() const {
+    return vertex_component_;
+  }
+
+  /// All vertices in ascending order
+  const std::vector<Index>& getVertices() const { return vertices_; }
+
+  /// View of a single component
+  SubGraphView getSubGraph(Index component) const;
+
+ private:
+  friend class SubGraphView;
+  void label_(const std::vector<Edge>& edges, bool parallel);
+
+  std::vector<Index> vertices_;
+  std::unordered_map<Index, Index> compact_index_;
+  std::vector<Index> vertex_component_;
+
+  // vertices and edges grouped by component
+  std::vector<Index> component_vertices_;
+  std::vector<Index> vertex_offsets_;
+  std::vector<Edge> component_edges_;
+  std::vector<Index> edge_offsets_;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_CONNECTEDCOMPONENTS_H
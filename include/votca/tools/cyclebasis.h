@@ -0,0 +1,70 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_CYCLEBASIS_H
+#define VOTCA_TOOLS_CYCLEBASIS_H
+
+// Standard includes
+#include <vector>
+
+// Local VOTCA includes
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+class Graph;
+
+/**
+ * \brief Finds a minimum cycle basis, the smallest set of smallest rings
+ *
+ * The rings are returned as the vertices met when walking around them,
+ * starting at the smallest vertex and continuing towards its smaller
+ * neighbor on the ring. Rings are sorted by size and then by vertices.
+ *
+ * E.g. for the two fused rings
+ *
+ * 0 - 1 - 2
+ * |   |   |
+ * 3 - 4 - 5
+ *
+ * the rings {0, 1, 4, 3} and {1, 2, 5, 4} are returned, but not the six
+ * membered ring around both.
+ *
+ * Vertices outside of rings are pruned first and every remaining connected
+ * ring system is handled separately. Within a ring system the candidates are
+ * the cycles formed by a non tree edge and the shortest paths to its ends,
+ * rooted only at the junctions of the ring system (vertices with three or
+ * more ring bonds, as in a ReducedGraph), since every ring of the basis
+ * passes through one unless the ring system is a single ring. Candidates are
+ * accepted in order of size if they are independent of the rings accepted
+ * before, which is tested by Gaussian elimination over the ring edges.
+ * Candidates are generated in windows of growing size, searching only as
+ * far from each root as the window needs, so large ring systems of small
+ * rings do not need memory quadratic in their size. For molecules, where
+ * ring systems are small, the cost is close to linear in the size of the
+ * graph.
+ *
+ * Self loops are ignored and multiple edges between two vertices count as a
+ * single edge.
+ */
+std::vector<std::vector<Index>> findMinimumCycleBasis(const Graph& graph);
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_CYCLEBASIS_H
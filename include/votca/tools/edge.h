@@ -20,10 +20,10 @@
 #define VOTCA_TOOLS_EDGE_H
 
 // Standard includes
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <limits>
-#include <utility>
-#include <vector>
 
 // Local VOTCA includes
 #include "types.h"
@@ -38,23 +38,25 @@ namespace tools {
  * are connected (id1,id2). Unlike a pair the vertex with the lower value is
  * always placed in id1, this allows us to reduce ambiguity when dealing with
  * a link.
+ *
+ * The two ids are stored inline and the class has no virtual methods, so an
+ * edge is trivially copyable and occupies two Index values.
  */
 class Edge {
- protected:
-  std::vector<Index> vertices_;
-
  public:
   Edge() = default;
-  virtual ~Edge() = default;
   /// Creates an edge the smallest integer value will be placed in the id1
   /// spot and the larger in the id2 spot
-  Edge(Index ID1, Index ID2);
+  Edge(Index ID1, Index ID2)
+      : vertex1_(ID1 < ID2 ? ID1 : ID2), vertex2_(ID1 < ID2 ? ID2 : ID1) {}
   /// Given one of the integers in the edge the other will be output
-  Index getOtherEndPoint(Index ver) const;
+  Index getOtherEndPoint(Index ver) const {
+    return (ver == vertex1_) ? vertex2_ : vertex1_;
+  }
   /// grab the smaller integer
-  Index getEndPoint1() const { return vertices_.front(); }
+  Index getEndPoint1() const { return vertex1_; }
   /// grab the larger integer
-  Index getEndPoint2() const { return vertices_.back(); }
+  Index getEndPoint2() const { return vertex2_; }
 
   /**
    * \brief Checks to see if an edge loops back on itself.
@@ -62,14 +64,16 @@ class Edge {
    * If both ends of the edge point to the same vertex than it is considered a
    * loop.
    **/
-  bool loop() const { return vertices_.front() == vertices_.back(); }
+  bool loop() const { return vertex1_ == vertex2_; }
 
   /// Determine if the edge contains the Index ID
-  bool contains(Index ID) const;
+  bool contains(Index ID) const { return vertex1_ == ID || vertex2_ == ID; }
   /// Checks if Edges are equivalent
-  virtual bool operator==(const Edge& ed) const;
+  bool operator==(const Edge& ed) const {
+    return vertex1_ == ed.vertex1_ && vertex2_ == ed.vertex2_;
+  }
   /// Checks if Edges are not equivalent
-  virtual bool operator!=(const Edge& ed) const;
+  bool operator!=(const Edge& ed) const { return !(*this == ed); }
 
   /// If the vertices are smaller in value
   /// Edge ed1(2,3);
@@ -79,13 +83,20 @@ class Edge {
   /// assert(ed2<ed1); // will return true
   /// assert(ed3<ed1); // will return true
   /// assert(ed3<ed1); // will return true
-  virtual bool operator<(const Edge& ed) const;
-  virtual bool operator>(const Edge& ed) const;
-  virtual bool operator<=(const Edge& ed) const;
-  virtual bool operator>=(const Edge& ed) const;
+  bool operator<(const Edge& ed) const {
+    return vertex1_ < ed.vertex1_ ||
+           (vertex1_ == ed.vertex1_ && vertex2_ < ed.vertex2_);
+  }
+  bool operator>(const Edge& ed) const { return ed < *this; }
+  bool operator<=(const Edge& ed) const { return !(ed < *this); }
+  bool operator>=(const Edge& ed) const { return !(*this < ed); }
 
   /// Print the contents of the edge
   friend std::ostream& operator<<(std::ostream& os, const Edge& ed);
+
+ private:
+  Index vertex1_ = 0;
+  Index vertex2_ = 0;
 };
 
 // Value used as a dummy object
@@ -95,13 +106,22 @@ const Edge DUMMY_EDGE(std::numeric_limits<Index>::max(),
 }  // namespace votca
 
 /// Define a hasher so we can use it as a key in an unordered_map
+///
+/// Both end points are packed into one 64 bit word which is passed through
+/// the splitmix64 finalizer, so edges such as (1,2) and (0,3) do not collide
+/// and neighbouring edges land in unrelated buckets.
 namespace std {
 template <>
 class hash<votca::tools::Edge> {
  public:
   size_t operator()(const votca::tools::Edge& ed) const {
-    return hash<votca::Index>()(ed.getEndPoint1()) ^
-           hash<votca::Index>()(ed.getEndPoint2());
+    std::uint64_t value =
+        static_cast<std::uint64_t>(ed.getEndPoint1()) *
+            0x9e3779b97f4a7c15ULL ^
+        static_cast<std::uint64_t>(ed.getEndPoint2());
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<size_t>(value ^ (value >> 31));
   }
 };
 }  // namespace std
@@ -74,6 +74,9 @@ class EdgeContainer {
   std::vector<Index> getNeighVertices(Index vertex) const;
   /// Get the edges neighboring vert
   std::vector<Edge> getNeighEdges(Index vertex) const;
+  /// Replaces the contents of edges with the edges of vertex, reusing its
+  /// capacity
+  void getNeighEdges(Index vertex, std::vector<Edge>& edges) const;
   /// Print output of object
   friend std::ostream& operator<<(std::ostream& os,
                                   const EdgeContainer edgecontainer);
@@ -24,6 +24,13 @@
 namespace votca {
 namespace tools {
 
+/**
+ * \brief Reading and writing of Eigen objects in the MatrixMarket format
+ *
+ * Dense matrices use the array format, sparse matrices the coordinate format.
+ * Large files are read into memory in one go and parsed and formatted in
+ * chunks by several threads. Values are written with full double precision.
+ */
 namespace EigenIO_MatrixMarket {
 
 Eigen::VectorXd ReadVector(const std::string& filename);
@@ -34,6 +41,17 @@ void WriteMatrix(const std::string& filename, const Eigen::MatrixXd& output);
 
 Eigen::MatrixXd ReadMatrix(const std::string& filename);
 
+/**
+ * \brief reads a real matrix in coordinate format
+ *
+ * General and symmetric matrices are supported, for symmetric matrices the
+ * upper triangle is filled in.
+ */
+Eigen::SparseMatrix<double> ReadSparseMatrix(const std::string& filename);
+
+void WriteSparseMatrix(const std::string& filename,
+                       const Eigen::SparseMatrix<double>& output);
+
 }  // namespace EigenIO_MatrixMarket
 
 }  // namespace tools
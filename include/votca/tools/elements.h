@@ -21,8 +21,9 @@
 #define VOTCA_TOOLS_ELEMENTS_H
 
 // Standard includes
-#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 // Local VOTCA includes
 #include "constants.h"
@@ -38,23 +39,16 @@ namespace tools {
     effective nuclear potential, element number as it appears in the periodic
     table.
 
+    All data lives in one constant table indexed by the element number, so
+    constructing an Elements object is free and every lookup is O(1). Symbols
+    are mapped to element numbers through a perfect hash of their two
+    characters. Properties can also be queried by element number directly.
+
  */
 class Elements {
  public:
-  Elements()
-      : _filled_VdWChelpG(false),
-        _filled_VdWMK(false),
-        _filled_NucCrg(false),
-        _filled_CovRad(false),
-        _filled_Mass(false),
-        _filled_EleNum(false),
-        _filled_EleName(false),
-        _filled_ElPolarizability(false),
-        _filled_EleShort(false),
-        _filled_EleFull(false){};
-
   /// Determine if the name is a recognized element symbol or name
-  bool isElement(std::string name);
+  bool isElement(const std::string& name) const;
 
   /// ChelpG is a method for calculating the electrostatic potential outside
   /// of a molecule. The VdWChelpG radius in this case is specific to each
@@ -62,7 +56,8 @@ class Elements {
   /// potential is calculated. The electrostatic potential within the radius
   /// is not calculated. For more information see the reference paper CHELPG
   /// paper [Journal of Computational Chemistry 11, 361, 1990]
-  double getVdWChelpG(std::string name);
+  double getVdWChelpG(const std::string& name) const;
+  double getVdWChelpG(Index elenum) const;
 
   /// Merz-Singh-Kollman MK method is a similar method for calculating the
   /// electrostatic potential outside of a molecule. Details of the method can
@@ -70,93 +65,70 @@ class Elements {
   /// electrostatic charges for molecules". Journal of computational chemistry
   /// 5 (2), 129, 1984]. The VdWMK method will return the radii used to define
   /// where the electrostatic grid starts.
-  double getVdWMK(std::string name);
+  double getVdWMK(const std::string& name) const;
+  double getVdWMK(Index elenum) const;
 
   /// Return the Nuclear charges of each atom. H - 1, He - 2, Na - 3 etc...
-  Index getNucCrg(std::string name);
+  Index getNucCrg(const std::string& name) const;
+  Index getNucCrg(Index elenum) const;
 
   /// Similar to the Nuclear charges but returns in integer form represents
   /// the id of the atom in the periodic table, the id starts at 1
-  Index getEleNum(std::string name);
+  Index getEleNum(const std::string& name) const;
 
   /// Returns the mass of each atom in a.u.
-  double getMass(std::string name);
+  double getMass(const std::string& name) const;
+  double getMass(Index elenum) const;
 
   /// Returns the atomic polarisability of atom
   // All polarizabilities in nm**3
   // Isotropic polarizability volume is evaluated from the tensor
   // as (a_xx * a_yy * a_zz )^(1/3) for eigenvalues of the polarizability tensor
-  double getPolarizability(std::string name);
+  double getPolarizability(const std::string& name) const;
+  double getPolarizability(Index elenum) const;
 
   /// Returns the covalent Radii of the atom
-  double getCovRad(std::string name, std::string unit);
+  double getCovRad(const std::string& name, const std::string& unit) const;
+  double getCovRad(Index elenum, const std::string& unit) const;
 
   /// Provided the element number returns the symbol for the element name
   /// (1) = "H", (2) = "He", ...
-  std::string getEleName(Index elenum);
+  std::string getEleName(Index elenum) const;
 
   /// Provided the full element name returns the element symbol
   /// "Hydrogen" = "H", "HELIUM" = "He",...
-  std::string getEleShort(std::string elefull);
+  std::string getEleShort(const std::string& elefull) const;
 
   /// Is `eleshort` recognized an element symbol i.e. H, C, He, Ne etc
-  bool isEleShort(std::string shortname);
+  bool isEleShort(const std::string& shortname) const;
 
   /// Is `elefull` recognized as an element name i.e. Carbon, HYDROGEN, suphur
-  bool isEleFull(std::string fullname);
+  bool isEleFull(const std::string& fullname) const;
 
-  bool isMassAssociatedWithElement(double mass, double tolerance);
+  bool isMassAssociatedWithElement(double mass, double tolerance) const;
 
   /// Get the shortened element name given a mass similar in size to one of
   /// the elements. Provided the mass is within the specified tolerance of
   /// the match.
-  std::string getEleShortClosestInMass(double mass, double tolerance);
+  std::string getEleShortClosestInMass(double mass, double tolerance) const;
+
+  /// Classifies many masses at once, returns for each mass the element number
+  /// of the element closest in mass or 0 if the relative deviation exceeds
+  /// the tolerance
+  std::vector<Index> getEleNumClosestInMass(const std::vector<double>& masses,
+                                            double tolerance) const;
 
   /// Provided the element symbol returns the element name
   /// "Pb" = "LEAD", "Na" = "SODIUM", ....
-  std::string getEleFull(std::string eleshort);
+  std::string getEleFull(const std::string& eleshort) const;
 
- private:
-  // cache variables
-  bool _filled_VdWChelpG = false;
-  bool _filled_VdWMK = false;
-  bool _filled_NucCrg = false;
-  bool _filled_CovRad = false;
-  bool _filled_Mass = false;
-  bool _filled_EleNum = false;
-  bool _filled_EleName = false;
-  bool _filled_ElPolarizability = false;
-  bool _filled_EleShort = false;
-  bool _filled_EleFull = false;
-
-  std::map<std::string, double> _VdWChelpG;
-  std::map<std::string, double> _VdWMK;
-  std::map<std::string, Index> _NucCrg;
-  std::map<std::string, double> _CovRad;
-  std::map<std::string, double> _Mass;
-  std::map<std::string, Index> _EleNum;
-  std::map<Index, std::string> _EleName;
-
-  std::map<std::string, double> _ElPolarizability;
-
-  std::map<std::string, std::string> _EleShort;
-  std::map<std::string, std::string> _EleFull;
+  /// Element number of a symbol or 0 if it is not known, never throws
+  static Index SymbolToEleNum(const std::string& eleshort);
 
+ private:
   /// Finds the element closest in mass and returns the difference as well as
-  /// the string of elements short name
-  std::pair<std::string, double> findShortNameOfElementClosestInMass_(
-      double mass);
-
-  void FillMass();
-  void FillVdWChelpG();
-  void FillNucCrg();
-  void FillCovRad();
-  void FillEleNum();
-  void FillEleName();
-  void FillEleShort();
-  void FillEleFull();
-  void FillVdWMK();
-  void FillPolarizability();
+  /// the element number, binary search in the elements sorted by mass
+  std::pair<Index, double> findElementClosestInMass_(double mass) const;
 };
 }  // namespace tools
 }  // namespace votca
@@ -21,6 +21,8 @@
 #define VOTCA_TOOLS_GRAPH_H
 
 // Standard includes
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -51,16 +53,35 @@ class Graph {
   std::unordered_map<Index, GraphNode> nodes_;
 
   /// This is the id of the graph to graphs that contain the same content
-  /// are considered equal
-  std::string id_;
+  /// are considered equal. It is only recalculated when it is requested after
+  /// the nodes have changed.
+  mutable std::string id_;
+  mutable std::atomic<bool> id_outdated_{false};
+
+  /// Smallest set of smallest rings, calculated on the first request after
+  /// the edges have changed.
+  mutable std::vector<std::vector<Index>> rings_;
+  mutable std::atomic<bool> rings_outdated_{true};
+
+  /// Serializes the lazy calculation of id_ and rings_, so const methods can
+  /// be called from several threads
+  mutable std::mutex lazy_mutex_;
 
  protected:
   /// Calculate the id of the graph
-  void calcId_();
+  void calcId_() const;
+  /// Mark the id as outdated, it is recalculated by the next getId
+  void invalidateId_() { id_outdated_ = true; }
+  /// Calculate the rings returned by getRings
+  virtual std::vector<std::vector<Index>> calcRings_() const;
 
  public:
   Graph() : id_(""){};
   virtual ~Graph() = default;
+  Graph(const Graph& graph);
+  Graph(Graph&& graph) noexcept;
+  Graph& operator=(const Graph& graph);
+  Graph& operator=(Graph&& graph) noexcept;
   /// Constructor
   /// @param edgs - vector of edges where each edge is composed of two
   /// s (vertex ids) describing a link between the vertices
@@ -82,8 +103,10 @@ class Graph {
   std::vector<std::pair<Index, GraphNode>> getNeighNodes(Index vertex) const;
 
   /// set the Node associated with vertex 'vert'
-  void setNode(Index vertex, GraphNode& graph_node);
-  void setNode(std::pair<Index, GraphNode>& id_and_node);
+  void setNode(Index vertex, const GraphNode& graph_node);
+  void setNode(const std::pair<Index, GraphNode>& id_and_node);
+  /// set the Nodes of several vertices at once
+  void setNodes(const std::vector<std::pair<Index, GraphNode>>& ids_and_nodes);
 
   /// Gets all vertices with degree of 3 or greater
   std::vector<Index> getJunctions() const;
@@ -100,17 +123,35 @@ class Graph {
     return edge_container_.getNeighVertices(vertex);
   }
 
-  /// Returns the id of graph
-  std::string getId() const { return id_; }
+  /// Returns the id of graph, it is calculated lazily but may be requested
+  /// from several threads at once
+  std::string getId() const {
+    if (id_outdated_.load(std::memory_order_acquire)) {
+      calcId_();
+    }
+    return id_;
+  }
+
+  /// Returns the smallest set of smallest rings, see findMinimumCycleBasis.
+  /// Like getId, it may be requested from several threads at once.
+  const std::vector<std::vector<Index>>& getRings() const;
 
   /// Returns all the edges in the graph
-  virtual std::vector<Edge> getEdges() { return edge_container_.getEdges(); }
+  virtual std::vector<Edge> getEdges() const {
+    return edge_container_.getEdges();
+  }
 
   /// Returns all the edges in the graph connected to vertex `vertex`
   std::vector<Edge> getNeighEdges(Index vertex) const {
     return edge_container_.getNeighEdges(vertex);
   }
 
+  /// Fills edges with the edges connected to vertex `vertex`, reusing the
+  /// capacity of the vector
+  void getNeighEdges(Index vertex, std::vector<Edge>& edges) const {
+    edge_container_.getNeighEdges(vertex, edges);
+  }
+
   /// Returns all the vertices in the graph
   std::vector<Index> getVertices() const;
 
@@ -144,6 +185,8 @@ class Graph {
   void copyNodes(Graph& graph);
 
   friend std::ostream& operator<<(std::ostream& os, const Graph graph);
+
+  friend class GraphSerializer;
 };
 
 /**
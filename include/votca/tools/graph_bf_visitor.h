@@ -21,8 +21,7 @@
 #define __VOTCA_TOOLS_GRAPH_BF_VISITOR_H
 
 #include "graphvisitor.h"
-#include <deque>
-#include <queue>
+#include <vector>
 
 /**
  * \brief A breadth first (BF) graph visitor
@@ -40,12 +39,19 @@ class GraphNode;
 
 class Graph_BF_Visitor : public GraphVisitor {
  private:
-  std::deque<std::queue<Edge>> edge_que_;
+  /// Edges waiting to be explored are edge_queue_[queue_front_] onwards,
+  /// the vector is only emptied once all of them have been taken, so its
+  /// capacity is reused
+  std::vector<Edge> edge_queue_;
+  size_t queue_front_ = 0;
+  /// scratch space for the edges of the vertex being explored
+  std::vector<Edge> neigh_edges_;
 
   /// The core of the breadth first visitor is in how the edges are added
   /// to the queue in this function
   void addEdges_(const Graph& graph, Index vertex) override;
   Edge getEdge_() override;
+  void clearEdges_() override;
 
  public:
   Graph_BF_Visitor() = default;
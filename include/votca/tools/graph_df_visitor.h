@@ -21,7 +21,7 @@
 #define VOTCA_TOOLS_GRAPH_DF_VISITOR_H
 
 // Standard includes
-#include <list>
+#include <vector>
 
 // Local VOTCA includes
 #include "graphvisitor.h"
@@ -42,12 +42,32 @@ class GraphNode;
 
 class Graph_DF_Visitor : public GraphVisitor {
  private:
-  std::list<Edge> edge_list_;
+  /**
+   * Every edge put on the stack gets an entry, entries are only appended
+   * during an exploration. An edge that has to move to the top of the stack
+   * is marked as not waiting and gets a new entry. next_to_vertex links the
+   * entries leading to the same unexplored vertex, starting from
+   * last_to_vertex_, so the edge to move is found without searching the
+   * stack.
+   */
+  struct StackEntry {
+    Edge edge;
+    Index next_to_vertex;
+    bool waiting;
+  };
+  std::vector<StackEntry> entries_;
+  /// entry ids in stack order, entries that no longer wait are skipped
+  std::vector<Index> edge_stack_;
+  Index waiting_edges_ = 0;
+  VertexStamps<Index> last_to_vertex_;
+  /// scratch space for the edges of the vertex being explored
+  std::vector<Edge> neigh_edges_;
 
   /// The core of the breadth first visitor is in how the edges are added
   /// to the queue in this function
   void addEdges_(const Graph& g, Index vertex) override;
   Edge getEdge_() override;
+  void clearEdges_() override;
 
  public:
   Graph_DF_Visitor() = default;
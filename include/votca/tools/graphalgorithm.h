@@ -145,11 +145,14 @@ ReducedGraph reduceGraph(Graph graph);
  *      4 - 5 - 6 -7
  *
  *
+ * The components are labelled with ConnectedComponents, use that class
+ * directly to inspect the components without copying them into graphs.
+ *
  * @param[in] - Graph instance
  * @return - vector containing shared pointers to all the sub graphs if there
  *           are no subgraphs than the input graph is returned.
  */
-std::vector<Graph> decoupleIsolatedSubGraphs(Graph graph);
+std::vector<Graph> decoupleIsolatedSubGraphs(const Graph& graph);
 
 /**
  * \brief Explore a graph with a graph visitor.
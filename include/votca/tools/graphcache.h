@@ -0,0 +1,172 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_GRAPHCACHE_H
+#define VOTCA_TOOLS_GRAPHCACHE_H
+
+// Standard includes
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+// Local VOTCA includes
+#include "edge.h"
+#include "graph.h"
+#include "graphalgorithm.h"
+#include "graphnode.h"
+#include "reducedgraph.h"
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+/**
+ * \brief Binary representation of graphs
+ *
+ * Graphs are appended to a byte buffer together with their nodes, including
+ * all node attributes and string ids, and the graph id. Reading a graph back
+ * restores these members directly, so neither the node ids nor the graph id
+ * or the chains of a reduced graph are recalculated. Numbers are stored in
+ * the byte order of the machine, the format is meant for a local cache and
+ * not for exchanging files.
+ */
+class GraphSerializer {
+ public:
+  /**
+   * \brief Hash of a graph definition which does not depend on the order of
+   * the edges or nodes
+   *
+   * The sorted edges and the nodes, sorted by vertex with their attributes
+   * sorted by name, are hashed with 64 bit FNV-1a.
+   */
+  static std::uint64_t ContentHash(
+      const std::vector<Edge>& edges,
+      const std::unordered_map<Index, GraphNode>& nodes);
+  /// Hash of a definition written with Write(edges, nodes, buffer)
+  static std::uint64_t ContentHash(const std::vector<char>& definition);
+
+  /// Writes a graph definition with sorted edges, nodes and attributes, so
+  /// equal definitions give equal bytes
+  static void Write(const std::vector<Edge>& edges,
+                    const std::unordered_map<Index, GraphNode>& nodes,
+                    std::vector<char>& buffer);
+  static void Write(const Graph& graph, std::vector<char>& buffer);
+  static void Write(const ReducedGraph& graph, std::vector<char>& buffer);
+
+  /// Reads a graph starting at data and advances data past it, throws if
+  /// the buffer ends before the graph does
+  static void Read(const char*& data, const char* end, Graph& graph);
+  static void Read(const char*& data, const char* end, ReducedGraph& graph);
+
+ private:
+  static void writeGraph_(const Graph& graph, std::vector<char>& buffer);
+  static void readGraph_(const char*& data, const char* end, Graph& graph);
+  static void writeNode_(const GraphNode& node, std::vector<char>& buffer);
+  static void readNode_(const char*& data, const char* end, GraphNode& node);
+};
+
+/**
+ * \brief Directory of graphs, reduced graphs and structure ids keyed by the
+ * content hash of the graph definition and the visitor
+ *
+ * The structure id and the node attributes of the stored graph depend on the
+ * visitor used to find the structure id, so entries are keyed by a visitor
+ * key as well, see VisitorKey. Each entry is one file named after the hash of
+ * both. The file also holds the key it was built from, which is compared on
+ * loading, so two keys with the same hash never share an entry. Files are
+ * memory mapped for reading where the system supports it and are written to
+ * a temporary file which is then renamed, so concurrent runs never see half
+ * written entries.
+ */
+class GraphCache {
+ public:
+  struct Entry {
+    Graph graph;
+    ReducedGraph reduced_graph;
+    std::string structure_id;
+  };
+
+  explicit GraphCache(std::string directory);
+
+  /// Key of the visitor GV, unique within one build of the library
+  template <class GV>
+  static std::string VisitorKey() {
+    return typeid(GV).name();
+  }
+
+  /// Hash of the definition together with the visitor key
+  static std::uint64_t Hash(const std::vector<Edge>& edges,
+                            const std::unordered_map<Index, GraphNode>& nodes,
+                            const std::string& visitor);
+
+  /// Path of the file storing the entry with this hash
+  std::string getFileName(std::uint64_t hash) const;
+
+  /// Returns false if there is no entry for the definition and visitor,
+  /// including when the file belongs to another definition, visitor or
+  /// version, or is truncated or corrupt
+  bool Load(const std::vector<Edge>& edges,
+            const std::unordered_map<Index, GraphNode>& nodes,
+            const std::string& visitor, Entry& entry) const;
+  /// Writes the entry for the definition and visitor, replacing any existing
+  /// file
+  void Store(const std::vector<Edge>& edges,
+             const std::unordered_map<Index, GraphNode>& nodes,
+             const std::string& visitor, const Entry& entry) const;
+
+  /**
+   * \brief Loads the entry for a graph definition, or builds and stores it
+   *
+   * On a cache miss, or if the stored entry can not be used, the graph is
+   * constructed, reduced with reduceGraph and its structure id is found with
+   * findStructureId using the visitor GV. The new entry overwrites the file.
+   * As with findStructureId the stored graph carries the node attributes
+   * added by the visitor, entries of different visitors are kept apart.
+   */
+  template <class GV>
+  Entry GetOrBuild(const std::vector<Edge>& edges,
+                   const std::unordered_map<Index, GraphNode>& nodes) const {
+    std::vector<char> key = key_(edges, nodes, VisitorKey<GV>());
+    Entry entry;
+    if (load_(key, entry)) {
+      return entry;
+    }
+    entry.graph = Graph(edges, nodes);
+    entry.reduced_graph = reduceGraph(entry.graph);
+    entry.structure_id = findStructureId<GV>(entry.graph);
+    store_(key, entry);
+    return entry;
+  }
+
+ private:
+  /// visitor key followed by the definition
+  static std::vector<char> key_(
+      const std::vector<Edge>& edges,
+      const std::unordered_map<Index, GraphNode>& nodes,
+      const std::string& visitor);
+  bool load_(const std::vector<char>& key, Entry& entry) const;
+  void store_(const std::vector<char>& key, const Entry& entry) const;
+
+  std::string directory_;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_GRAPHCACHE_H
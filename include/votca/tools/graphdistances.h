@@ -0,0 +1,105 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_GRAPHDISTANCES_H
+#define VOTCA_TOOLS_GRAPHDISTANCES_H
+
+// Standard includes
+#include <unordered_map>
+#include <vector>
+
+// Local VOTCA includes
+#include "eigen.h"
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+class Graph;
+
+/**
+ * \brief Bounded topological distances from many source vertices at once
+ *
+ * Unlike the GraphDistVisitor, which labels the nodes of a graph with a
+ * 'Dist' attribute for a single starting vertex, this class only reads the
+ * edges of a graph. On construction the adjacency is copied into a compressed
+ * row layout, afterwards breadth first searches limited to a maximum
+ * distance are run from any number of sources. Searches from different
+ * sources are distributed over the global ThreadPool, every thread reuses its
+ * own visited marks and frontiers so no memory is allocated per source.
+ *
+ * E.g. for the graph
+ *
+ * 0 - 1 - 2 - 3
+ *
+ * Neighbors(1, 1) returns {0,1} and {2,1}, the source itself is never part of
+ * its own neighbor list.
+ */
+class GraphDistances {
+ public:
+  struct Neighbor {
+    Index vertex;
+    Index distance;
+  };
+
+  explicit GraphDistances(const Graph& graph);
+
+  /// All vertices of the graph in ascending order, rows and columns of
+  /// DistanceMatrix follow this order
+  const std::vector<Index>& getVertices() const { return vertices_; }
+
+  /// Vertices within max_distance of source, sorted by distance and then by
+  /// vertex id
+  std::vector<Neighbor> Neighbors(Index source, Index max_distance) const;
+
+  /// Neighbor lists of several sources, element i belongs to sources[i]
+  std::vector<std::vector<Neighbor>> Neighbors(
+      const std::vector<Index>& sources, Index max_distance) const;
+
+  /// Neighbor lists of every vertex, in the order of getVertices()
+  std::vector<std::vector<Neighbor>> AllNeighbors(Index max_distance) const;
+
+  /**
+   * \brief Symmetric matrix of all distances up to max_distance
+   *
+   * Pairs further apart than max_distance, or not connected at all, are not
+   * stored. The zero distance of a vertex to itself is not stored either.
+   */
+  Eigen::SparseMatrix<Index> DistanceMatrix(Index max_distance) const;
+
+ private:
+  struct Scratch {
+    std::vector<Index> visited;
+    Index epoch = 0;
+    std::vector<Index> frontier;
+    std::vector<Index> next_frontier;
+  };
+
+  Index compactIndex_(Index vertex) const;
+  void search_(Index source, Index max_distance, Scratch& scratch,
+               std::vector<Neighbor>& neighbors) const;
+
+  std::vector<Index> vertices_;
+  std::unordered_map<Index, Index> compact_index_;
+  std::vector<Index> offsets_;
+  std::vector<Index> adjacency_;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_GRAPHDISTANCES_H
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_GRAPHMATCHER_H
+#define VOTCA_TOOLS_GRAPHMATCHER_H
+
+// Standard includes
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Local VOTCA includes
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+class Graph;
+
+/**
+ * \brief Finds how the vertices of a pattern graph correspond to a target
+ *
+ * Two vertices can only be matched if the string ids of their graph nodes
+ * are equal. The search follows the VF2 scheme: pattern vertices are matched
+ * one after the other in a fixed order in which every vertex, apart from the
+ * first of each connected component, is a neighbor of an earlier one. The
+ * candidates for a vertex are therefore only the neighbors of an already
+ * matched target vertex, and they are pruned by node label, degree and the
+ * adjacency to all earlier matches before the search descends.
+ *
+ * Multiple edges between two vertices count as one edge and self loops are
+ * ignored.
+ *
+ * Isomorphism() remembers the mapping it found for every graph id. When a
+ * target with a known id is passed, the cached mapping is translated to the
+ * new vertex ids, in ascending order, and verified in linear time. Repeated
+ * molecules that list their atoms in the same order therefore cost a single
+ * lookup, any other target falls back to the full search.
+ */
+class GraphMatcher {
+ public:
+  explicit GraphMatcher(const Graph& pattern);
+
+  /**
+   * \brief Maps the pattern onto a target with the same topology
+   *
+   * \return pattern vertex to target vertex, empty if the graphs are not
+   * isomorphic
+   */
+  std::unordered_map<Index, Index> Isomorphism(const Graph& target) const;
+
+  /**
+   * \brief Finds copies of the pattern inside a larger target
+   *
+   * Every pattern edge has to exist between the matched target vertices,
+   * additional target edges between them are allowed. Symmetric patterns
+   * are found once for every automorphism.
+   *
+   * \param[in] max_matches stop after this many matches, 0 finds all
+   * \return one pattern vertex to target vertex map per match
+   */
+  std::vector<std::unordered_map<Index, Index>> SubgraphMatches(
+      const Graph& target, Index max_matches = 0) const;
+
+  /// Number of graph ids with a cached isomorphism
+  Index CacheSize() const;
+
+ private:
+  struct CompactGraph {
+    std::vector<Index> vertices;
+    std::vector<Index> labels;
+    std::vector<Index> offsets;
+    std::vector<Index> adjacency;
+
+    Index size() const { return Index(vertices.size()); }
+    Index degree(Index vertex) const {
+      return offsets[vertex + 1] - offsets[vertex];
+    }
+    bool adjacent(Index vertex1, Index vertex2) const;
+  };
+
+  CompactGraph compact_(const Graph& graph) const;
+  void matchOrder_();
+  bool verify_(const CompactGraph& target,
+               const std::vector<Index>& mapping) const;
+  bool search_(const CompactGraph& target, bool isomorphism, Index depth,
+               std::vector<Index>& mapping, std::vector<Index>& preimage,
+               Index max_matches,
+               std::vector<std::vector<Index>>& matches) const;
+  std::unordered_map<Index, Index> toMap_(
+      const CompactGraph& target, const std::vector<Index>& mapping) const;
+
+  std::unordered_map<std::string, Index> label_ids_;
+  CompactGraph pattern_;
+  std::vector<Index> order_;
+  std::vector<Index> order_parent_;
+
+  mutable std::mutex cache_mutex_;
+  mutable std::unordered_map<std::string, std::vector<Index>> cache_;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_GRAPHMATCHER_H
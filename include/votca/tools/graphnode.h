@@ -78,6 +78,8 @@ class GraphNode {
 
   // Allow visitor to directly access members of the node
   friend GraphDistVisitor;
+  // Allow the cache to store and restore nodes without rebuilding the id
+  friend class GraphSerializer;
 
   friend std::ostream& operator<<(std::ostream& os, const GraphNode gn);
 };
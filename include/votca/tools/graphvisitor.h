@@ -21,7 +21,10 @@
 #define VOTCA_TOOLS_GRAPHVISITOR_H
 
 // Standard includes
+#include <algorithm>
+#include <cstdint>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 // Local VOTCA includes
@@ -49,10 +52,112 @@ namespace tools {
 
 class Graph;
 
+/**
+ * \brief Values attached to vertices that can be cleared in constant time
+ *
+ * Vertex ids index an array of stamps, a vertex has a value if its stamp
+ * equals the current stamp. Clearing only moves to the next stamp, so the
+ * arrays are neither touched nor reallocated when a visitor is reused. Vertex
+ * ids that are negative or much larger than the number of stored vertices are
+ * kept in a hash map instead, so sparse ids do not blow up the arrays.
+ */
+template <class T>
+class VertexStamps {
+ public:
+  void clear() {
+    if (++stamp_ == 0) {
+      // the stamps wrapped around, old entries could become valid again
+      std::fill(stamps_.begin(), stamps_.end(), 0);
+      stamp_ = 1;
+    }
+    sparse_.clear();
+    size_ = 0;
+  }
+
+  const T* find(Index vertex) const {
+    if (vertex >= 0 && vertex < Index(stamps_.size())) {
+      return stamps_[vertex] == stamp_ ? &values_[vertex] : nullptr;
+    }
+    auto found = sparse_.find(vertex);
+    return found == sparse_.end() ? nullptr : &found->second;
+  }
+  T* find(Index vertex) {
+    return const_cast<T*>(static_cast<const VertexStamps&>(*this).find(vertex));
+  }
+
+  /// Sets the value of a vertex and returns a reference to it
+  T& set(Index vertex, const T& value) {
+    T* existing = find(vertex);
+    if (existing) {
+      return *existing = value;
+    }
+    ++size_;
+    if (vertex >= Index(stamps_.size()) && vertex < 8 * size_ + 4096) {
+      Index new_size = std::max(vertex + 1, Index(stamps_.size()) * 3 / 2);
+      stamps_.resize(new_size, 0);
+      values_.resize(new_size);
+      // vertices that were too large before move into the arrays
+      for (auto it = sparse_.begin(); it != sparse_.end();) {
+        if (it->first >= 0 && it->first < new_size) {
+          stamps_[it->first] = stamp_;
+          values_[it->first] = it->second;
+          it = sparse_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    if (vertex >= 0 && vertex < Index(stamps_.size())) {
+      stamps_[vertex] = stamp_;
+      return values_[vertex] = value;
+    }
+    return sparse_[vertex] = value;
+  }
+
+  /// Number of vertices with a value
+  Index size() const { return size_; }
+
+  /// Calls f(vertex, value) for every vertex with a value
+  template <class F>
+  void forEach(F f) const {
+    for (Index vertex = 0; vertex < Index(stamps_.size()); ++vertex) {
+      if (stamps_[vertex] == stamp_) {
+        f(vertex, values_[vertex]);
+      }
+    }
+    for (const auto& vertex_and_value : sparse_) {
+      f(vertex_and_value.first, vertex_and_value.second);
+    }
+  }
+
+ private:
+  std::vector<std::uint32_t> stamps_;
+  std::vector<T> values_;
+  std::uint32_t stamp_ = 1;
+  std::unordered_map<Index, T> sparse_;
+  Index size_ = 0;
+};
+
+/// The vertices explored by a visitor, see VertexStamps
+class ExploredVertices {
+ public:
+  /// Forgets all vertices in constant time
+  void clear() { marks_.clear(); }
+  void insert(Index vertex) { marks_.set(vertex, 1); }
+  /// 1 if the vertex was explored and 0 otherwise, as for std::set
+  Index count(Index vertex) const { return marks_.find(vertex) ? 1 : 0; }
+  /// Number of explored vertices
+  Index size() const { return marks_.size(); }
+  std::set<Index> toSet() const;
+
+ private:
+  VertexStamps<char> marks_;
+};
+
 class GraphVisitor {
  protected:
-  /// set containing all the vertix ids that have been explored
-  std::set<Index> explored_;
+  /// all the vertex ids that have been explored
+  ExploredVertices explored_;
 
   /// The vertex the visitor started on
   Index startingVertex_ = 0;
@@ -60,6 +165,12 @@ class GraphVisitor {
   /// What is done to an individual graph node as it is explored
   virtual void addEdges_(const Graph& graph, Index vertex) = 0;
   virtual Edge getEdge_() = 0;
+  /// Empties the edge queue so the visitor can be initialized again
+  virtual void clearEdges_() {}
+
+  /// Number of unexplored end points of the edge, unexplored is set to the
+  /// first of them
+  Index countUnexplored_(const Edge& edge, Index& unexplored) const;
   /// Edge(0,0) is a dummy value
  public:
   virtual void exploreNode(std::pair<Index, GraphNode>& vertex_and_node,
@@ -81,6 +192,10 @@ class GraphVisitor {
   /// Initialize the graphvisitor the default starting point is 0
   void initialize(Graph& graph);
 
+  /// Forgets all explored vertices and queued edges so the visitor can
+  /// explore again, the memory of the previous exploration is reused
+  void reset();
+
   /// What the visitor does to each node as it is visited, it will
   /// simply add the vertex that was explored to the list of explored
   /// vertices in its current form.
@@ -89,11 +204,14 @@ class GraphVisitor {
   /// The next edge to be explored, note that when this function
   /// is called it removes the edge from the visitors queue and will
   /// no longer be accessible with a second call to nextEdge
-  Edge nextEdge(Graph graph);
+  Edge nextEdge(const Graph& graph);
 
   /// Get the set of all the vertices that have been explored
   std::set<Index> getExploredVertices() const;
 
+  /// Number of vertices that have been explored
+  Index getExploredCount() const { return explored_.size(); }
+
   /// Has the vertex been explored
   bool vertexExplored(const Index vertex) const;
 };
@@ -20,10 +20,14 @@
 
 // Standard includes
 #include <cmath>
+#include <iterator>
 #include <limits>
+#include <type_traits>
 
 // Local VOTCA includes
+#include "profiler.h"
 #include "table.h"
+#include "threadpool.h"
 
 namespace votca {
 namespace tools {
@@ -94,6 +98,9 @@ class HistogramNew {
 
   /**
       \brief process a range of data using iterator interface
+
+      Large ranges with random access iterators are binned in parallel on
+      ThreadPool::Global(), every thread counts into its own bins.
    */
   template <typename iterator_type>
   void ProcessRange(const iterator_type &begin, const iterator_type &end);
@@ -165,6 +172,15 @@ class HistogramNew {
 
  private:
   void Initialize_();
+  /// bin of v or -1 if v is outside of a non periodic interval
+  Index bin(double v) const;
+  template <typename iterator_type>
+  void ProcessRange_(const iterator_type &begin, const iterator_type &end,
+                     std::random_access_iterator_tag);
+  template <typename iterator_type>
+  void ProcessRange_(const iterator_type &begin, const iterator_type &end,
+                     std::input_iterator_tag);
+
   double _min = 0;
   double _max = 0;
   double _step = 0;
@@ -181,9 +197,49 @@ inline std::ostream &operator<<(std::ostream &out, HistogramNew &h) {
 template <typename iterator_type>
 inline void HistogramNew::ProcessRange(const iterator_type &begin,
                                        const iterator_type &end) {
+  VOTCA_PROFILE_REGION("HistogramNew::ProcessRange");
+  ProcessRange_(
+      begin, end,
+      typename std::iterator_traits<iterator_type>::iterator_category());
+}
+
+template <typename iterator_type>
+inline void HistogramNew::ProcessRange_(const iterator_type &begin,
+                                        const iterator_type &end,
+                                        std::input_iterator_tag) {
+  Index count = 0;
   for (iterator_type iter = begin; iter != end; ++iter) {
     Process(*iter);
+    ++count;
+  }
+  VOTCA_PROFILE_COUNT("HistogramNew values", count);
+}
+
+template <typename iterator_type>
+inline void HistogramNew::ProcessRange_(const iterator_type &begin,
+                                        const iterator_type &end,
+                                        std::random_access_iterator_tag) {
+  // below this size starting the threads costs more than binning
+  const Index min_parallel_size = 100000;
+  Index count = Index(end - begin);
+  ThreadPool &pool = ThreadPool::Global();
+  if (count < min_parallel_size || pool.size() == 1) {
+    ProcessRange_(begin, end, std::input_iterator_tag());
+    return;
+  }
+  // bins are counted with weight 1, so the sums are exact and the result
+  // does not depend on the number of threads
+  WorkerLocal<Eigen::VectorXd> counts(pool, Eigen::VectorXd::Zero(_nbins));
+  pool.parallel_for(0, count, [&](Index i) {
+    Index b = bin(double(begin[i]));
+    if (b >= 0) {
+      counts.local()(b) += 1.0;
+    }
+  });
+  for (const Eigen::VectorXd &local : counts) {
+    _data.y() += local;
   }
+  VOTCA_PROFILE_COUNT("HistogramNew values", count);
 }
 }  // namespace tools
 }  // namespace votca
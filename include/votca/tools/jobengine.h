@@ -0,0 +1,172 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_JOBENGINE_H
+#define VOTCA_TOOLS_JOBENGINE_H
+
+// Standard includes
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Local VOTCA includes
+#include "calculator.h"
+#include "lockfreequeue.h"
+#include "property.h"
+#include "threadpool.h"
+
+namespace votca {
+namespace tools {
+
+/**
+ * \brief Calculator which evaluates independent jobs
+ *
+ * The JobEngine creates one instance per thread, so implementations do not
+ * need any locking for their members.
+ */
+class JobCalculator : public Calculator {
+ public:
+  /**
+   * \brief evaluates a single job
+   * @param input the input section of the job
+   * @param output empty property for the results of the job
+   * @return false if the job failed
+   */
+  virtual bool EvalJob(const Property &input, Property &output) = 0;
+};
+
+/**
+ * \brief Single job as described in a job file
+ *
+ * A job file looks like
+ * <jobs>
+ *   <job>
+ *     <id>1</id>
+ *     <tag>some description</tag>
+ *     <input>...</input>
+ *     <status>AVAILABLE</status>
+ *   </job>
+ * </jobs>
+ */
+class Job {
+ public:
+  enum Status { AVAILABLE, COMPLETE, FAILED };
+
+  explicit Job(const Property &job);
+
+  Index getId() const { return _id; }
+  const std::string &getTag() const { return _tag; }
+  const Property &getInput() const { return _input; }
+  const Property &getOutput() const { return _output; }
+  Property &getOutput() { return _output; }
+  Status getStatus() const { return _status; }
+  void setStatus(Status status) { _status = status; }
+
+  static std::string StatusToString(Status status);
+  static Status StringToStatus(const std::string &status);
+
+  /// adds the job with its status and output as child "job" to jobs
+  void AddToProperty(Property &jobs) const;
+
+ private:
+  Index _id;
+  std::string _tag;
+  Property _input;
+  Property _output;
+  Status _status;
+};
+
+/**
+ * \brief Distributes the jobs of a job file over the threads of a ThreadPool
+ *
+ * Job indices are handed out through a LockFreeQueue, so workers never wait
+ * for each other. Every worker loop gets its own JobCalculator from the
+ * factory, so one instance is never used by two threads at the same time.
+ * Ids of finished jobs are appended to an optional checkpoint file, jobs
+ * listed there are skipped when the engine is run again.
+ */
+class JobEngine {
+ public:
+  using CalculatorFactory = std::function<std::unique_ptr<JobCalculator>()>;
+  using ProgressCallback = std::function<void(Index finished, Index total)>;
+
+  /// reads all jobs from jobs.job
+  explicit JobEngine(const Property &jobfile);
+
+  /**
+   * \brief sets the checkpoint file
+   *
+   * If the file exists, all job ids in it are marked as complete.
+   */
+  void setCheckpointFile(const std::string &filename);
+
+  /**
+   * \brief sets a callback that reports the number of finished jobs
+   *
+   * It is called whenever a batch of finished jobs has been written to the
+   * checkpoint file, so one call can cover several jobs. After a successful
+   * Run the last call has finished == total. It is called from worker threads,
+   * but never concurrently.
+   */
+  void setProgressCallback(ProgressCallback callback) {
+    _progress = std::move(callback);
+  }
+
+  /**
+   * \brief evaluates all available jobs
+   *
+   * factory is called from the worker threads of pool, possibly at the same
+   * time, so it has to be thread-safe.
+   */
+  void Run(const CalculatorFactory &factory,
+           ThreadPool &pool = ThreadPool::Global());
+
+  const std::vector<Job> &getJobs() const { return _jobs; }
+  Index NumberOfJobs() const { return Index(_jobs.size()); }
+  Index NumberOfCompletedJobs() const;
+  Index NumberOfFailedJobs() const;
+
+  /// jobs with status and output in the job file format
+  Property Results() const;
+  void WriteResults(const std::string &filename) const;
+
+ private:
+  // writes the ids of finished jobs to the checkpoint file and reports the
+  // progress, only one thread does this at a time
+  void Flush(bool wait);
+
+  std::vector<Job> _jobs;
+  std::string _checkpoint_file;
+  std::ofstream _checkpoint;
+  std::unordered_set<Index> _checkpointed;
+  ProgressCallback _progress;
+
+  std::unique_ptr<LockFreeQueue<Index>> _finished_jobs;
+  std::atomic<Index> _nfinished{0};
+  Index _ntotal = 0;
+  std::mutex _flush_mutex;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_JOBENGINE_H
@@ -19,30 +19,126 @@
 #define VOTCA_TOOLS_LEXICAL_CAST_H
 
 // Standard includes
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 
 // Third party includes
 #include <boost/lexical_cast.hpp>
+#include <boost/utility/string_ref.hpp>
 
 namespace votca {
 namespace tools {
 
+// parse a complete token, throw boost::bad_lexical_cast on failure
+double TokenToDouble(boost::string_ref token);
+long long TokenToLongLong(boost::string_ref token);
+unsigned long long TokenToULongLong(boost::string_ref token);
+
+namespace detail {
+template <typename T>
+inline T ConvertToken(boost::string_ref token, std::true_type /*floating*/,
+                      std::false_type /*integral*/) {
+  return T(TokenToDouble(token));
+}
+
+template <typename T>
+inline T ConvertToken(boost::string_ref token, std::false_type /*floating*/,
+                      std::true_type /*integral*/) {
+  if (std::is_signed<T>::value) {
+    long long value = TokenToLongLong(token);
+    if (value < static_cast<long long>(std::numeric_limits<T>::min()) ||
+        value > static_cast<long long>(std::numeric_limits<T>::max())) {
+      throw boost::bad_lexical_cast(typeid(std::string), typeid(T));
+    }
+    return T(value);
+  } else {
+    unsigned long long value = TokenToULongLong(token);
+    if (value > static_cast<unsigned long long>(
+                    std::numeric_limits<T>::max())) {
+      throw boost::bad_lexical_cast(typeid(std::string), typeid(T));
+    }
+    return T(value);
+  }
+}
+
+template <typename T>
+inline T ConvertToken(boost::string_ref token, std::false_type /*floating*/,
+                      std::false_type /*integral*/) {
+  return boost::lexical_cast<T>(token.to_string());
+}
+}  // namespace detail
+
+/**
+ * \brief converts a single token to a number without heap allocations
+ *
+ * Floating point and integer targets are parsed directly with the C library,
+ * everything else (bool, characters, classes) is forwarded to
+ * boost::lexical_cast. The whole token has to be consumed, otherwise
+ * boost::bad_lexical_cast is thrown just like boost::lexical_cast would do.
+ */
+template <typename T>
+inline T ConvertToken(boost::string_ref token) {
+  return detail::ConvertToken<T>(
+      token, std::is_floating_point<T>(),
+      std::integral_constant<bool, std::is_integral<T>::value &&
+                                       !std::is_same<T, bool>::value &&
+                                       (sizeof(T) > 1)>());
+}
+
+namespace detail {
+template <typename Target, typename Source>
+inline Target Convert(const Source &arg) {
+  return boost::lexical_cast<Target>(arg);
+}
+
+template <typename Target>
+inline Target Convert(const std::string &arg) {
+  return tools::ConvertToken<Target>(arg);
+}
+
+template <typename Target>
+inline Target Convert(const boost::string_ref &arg) {
+  return tools::ConvertToken<Target>(arg);
+}
+}  // namespace detail
+
 /**
  * Wrapper for boost::lexical_cast with improved error messages
  * @param arg variable to convert
  * @param error additional error text
  * @return converted value
+ *
+ * Strings are converted to numbers with ConvertToken.
  */
 template <typename Target, typename Source>
 inline Target lexical_cast(const Source &arg, const std::string &error) {
   try {
-    return boost::lexical_cast<Target, Source>(arg);
+    return detail::Convert<Target>(arg);
   } catch (std::exception &) {
     throw std::runtime_error("invaid type: " + error);
   }
 }
 
+/**
+ * Same as above, but the error text is only built if the conversion fails
+ * @param arg variable to convert
+ * @param error callable returning the additional error text
+ * @return converted value
+ */
+template <typename Target, typename Source, typename ErrorMessage>
+inline std::enable_if_t<!std::is_convertible<ErrorMessage, std::string>::value,
+                        Target>
+    lexical_cast(const Source &arg, const ErrorMessage &error) {
+  try {
+    return detail::Convert<Target>(arg);
+  } catch (std::exception &) {
+    throw std::runtime_error("invaid type: " + std::string(error()));
+  }
+}
+
 }  // namespace tools
 }  // namespace votca
 
@@ -39,13 +39,82 @@ Eigen::VectorXd linalg_constrained_qrsolve(const Eigen::MatrixXd& A,
                                            const Eigen::VectorXd& b,
                                            const Eigen::MatrixXd& constr);
 
+/**
+ * \brief Interface for a symmetric operator which is only known by its
+ * action on a vector
+ *
+ * Derived classes only have to provide the dimension and the product with a
+ * vector, so the operator never has to be stored as a dense matrix.
+ */
+class MatrixFreeOperator {
+ public:
+  virtual ~MatrixFreeOperator() = default;
+
+  /// dimension of the (square) operator
+  virtual Index size() const = 0;
+
+  /**
+   * \brief calculates y = A*x
+   * @param x input vector of length size()
+   * @param y output vector, already resized to size()
+   */
+  virtual void matmul(const Eigen::VectorXd& x, Eigen::VectorXd& y) const = 0;
+};
+
+/**
+ * \brief MatrixFreeOperator view on a dense symmetric matrix
+ *
+ * The matrix vector product is split in up to nthreads blocks of rows, which
+ * are evaluated on ThreadPool::Global(). The matrix is not copied and has to
+ * outlive the operator.
+ */
+class DenseOperator : public MatrixFreeOperator {
+ public:
+  DenseOperator(const Eigen::MatrixXd& A, Index nthreads = 1)
+      : _A(A), _nthreads(nthreads) {}
+
+  Index size() const final { return _A.rows(); }
+
+  void matmul(const Eigen::VectorXd& x, Eigen::VectorXd& y) const final;
+
+ private:
+  const Eigen::MatrixXd& _A;
+  Index _nthreads;
+};
+
+/**
+ * \brief solves A*V=E*V for the nmax lowest eigenvalues with a thick restart
+ * Lanczos iteration
+ * @param A symmetric operator
+ * @param nmax number of eigenvalues to return
+ * @param tol convergence threshold for the residual norm relative to the
+ * largest Ritz value
+ * @param max_restarts maximum number of restarts of the Krylov subspace
+ *
+ * Only matrix vector products with A are required and the memory consumption
+ * is proportional to size()*nmax. If the iteration does not converge, info()
+ * of the result is set to Eigen::NoConvergence.
+ *
+ * Every restart costs about max(nmax,20)/2 matrix vector products plus the
+ * reorthogonalisation, O(size()*nmax^2). Callers that fall back to a full
+ * diagonalisation on failure, like linalg_eigenvalues, pay for all restarts
+ * on top of it, so max_restarts should stay small.
+ */
+EigenSystem linalg_lanczos_eigenvalues(const MatrixFreeOperator& A, Index nmax,
+                                       double tol = 1e-10,
+                                       Index max_restarts = 50);
+
 /**
  * \brief solves A*V=E*V for the first n eigenvalues
  * @param A symmetric matrix to diagonalize, is destroyed during iteration
  * @param nmax number of eigenvalues to return
  *
- * This function is only useful if MKL is used, wraps
- * LAPACKE_dsyevx
+ * If MKL is used, this wraps LAPACKE_dsyevx. Otherwise large matrices with
+ * nmax much smaller than the dimension are solved with
+ * linalg_lanczos_eigenvalues using a multithreaded matrix vector product,
+ * and all others are fully diagonalized. If the Lanczos iteration does not
+ * converge within its default number of restarts, the matrix is fully
+ * diagonalized as well, so hard spectra cost the failed iteration extra.
  */
 EigenSystem linalg_eigenvalues(Eigen::MatrixXd& A, Index nmax);
 
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_LOCKFREEQUEUE_H
+#define VOTCA_TOOLS_LOCKFREEQUEUE_H
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+// Local VOTCA includes
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+/**
+ * \brief Bounded multi producer multi consumer queue without locks
+ *
+ * Every slot of the ring buffer carries a sequence number, which tells
+ * producers and consumers whether the slot is free or filled. Threads only
+ * compete for the head and tail counters with a compare and swap, so neither
+ * push nor pop ever blocks. The capacity is rounded up to a power of two.
+ */
+template <class T>
+class LockFreeQueue {
+ public:
+  explicit LockFreeQueue(Index capacity) {
+    std::size_t size = 2;
+    while (size < std::size_t(capacity)) {
+      size *= 2;
+    }
+    _mask = size - 1;
+    _cells = std::unique_ptr<Cell[]>(new Cell[size]);
+    for (std::size_t i = 0; i < size; i++) {
+      _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  LockFreeQueue(const LockFreeQueue&) = delete;
+  LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+  Index capacity() const { return Index(_mask + 1); }
+
+  /// appends value, returns false if the queue is full
+  bool push(T value) {
+    std::size_t pos = _tail.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &_cells[pos & _mask];
+      std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = std::ptrdiff_t(seq) - std::ptrdiff_t(pos);
+      if (diff == 0) {
+        if (_tail.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = _tail.load(std::memory_order_relaxed);
+      }
+    }
+    cell->data = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// removes the oldest entry into value, returns false if the queue is empty
+  bool pop(T& value) {
+    std::size_t pos = _head.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &_cells[pos & _mask];
+      std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t diff = std::ptrdiff_t(seq) - std::ptrdiff_t(pos + 1);
+      if (diff == 0) {
+        if (_head.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = _head.load(std::memory_order_relaxed);
+      }
+    }
+    value = std::move(cell->data);
+    cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    T data;
+  };
+
+  std::unique_ptr<Cell[]> _cells;
+  std::size_t _mask;
+  // head and tail on separate cache lines to avoid false sharing
+  alignas(64) std::atomic<std::size_t> _tail{0};
+  alignas(64) std::atomic<std::size_t> _head{0};
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_LOCKFREEQUEUE_H
@@ -40,6 +40,11 @@ class Mutex {
   void Lock();
   void Unlock();
 
+  // lower case versions make Mutex usable with std::lock_guard and ScopedLock
+  void lock() { Lock(); }
+  void unlock() { Unlock(); }
+  bool try_lock();
+
  private:
   pthread_mutex_t _mutexVar;
 };
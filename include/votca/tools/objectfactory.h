@@ -19,13 +19,22 @@
 #define VOTCA_TOOLS_OBJECTFACTORY_H
 
 // Standard includes
+#include <algorithm>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 // Third party includes
 #include <boost/lexical_cast.hpp>
 
+// Local VOTCA includes
+#include "types.h"
+
 namespace votca {
 namespace tools {
 
@@ -38,13 +47,18 @@ namespace tools {
    (e.g. new file formats, new mapping algorithms) without touching or
    recompiling existing bits of code.
 
+    Additional template arguments are passed on to the constructors of the
+   created objects. Once all objects are registered, Freeze moves the registry
+   into a sorted vector, which makes lookups in Create cheaper and forbids
+   further registrations.
+
     If you don't understand this, read the book by Alexandresku (Modern C++
    design) everything explained there in detail!
 */
-template <typename key_t, typename T>
+template <typename key_t, typename T, typename... args_t>
 class ObjectFactory {
  private:
-  using creator_t = T *(*)();
+  using creator_t = T *(*)(args_t...);
 
  public:
   using abstract_type = T;
@@ -70,51 +84,101 @@ class ObjectFactory {
   /**
      Create an instance of the object identified by key.
   */
-  T *Create(const key_t &key);
+  T *Create(const key_t &key, args_t... args);
+  /**
+     Same as Create, the caller owns the object
+  */
+  std::unique_ptr<T> CreateUnique(const key_t &key, args_t... args) {
+    return std::unique_ptr<T>(Create(key, std::forward<args_t>(args)...));
+  }
   bool IsRegistered(const key_t &_id) const;
 
-  static ObjectFactory<key_t, T> &Instance() {
-    static ObjectFactory<key_t, T> _this;
+  /**
+   * \brief finish the registration
+   *
+   * Lookups afterwards use a binary search on a sorted vector, Register
+   * throws. Concurrent calls of Create are safe after freezing.
+   */
+  void Freeze();
+  bool IsFrozen() const { return _frozen; }
+
+  static ObjectFactory<key_t, T, args_t...> &Instance() {
+    static ObjectFactory<key_t, T, args_t...> _this;
     return _this;
   }
 
   const assoc_map &getObjects() { return _objects; }
 
  private:
+  creator_t Find(const key_t &key) const;
+
   assoc_map _objects;
+  std::vector<std::pair<key_t, creator_t>> _frozen_objects;
+  bool _frozen = false;
 };
 
-template <class parent, class T>
-parent *create_policy_new() {
-  return new T();
+template <class parent, class T, typename... args_t>
+parent *create_policy_new(args_t... args) {
+  return new T(std::forward<args_t>(args)...);
 }
 
-template <typename key_t, typename T>
-inline void ObjectFactory<key_t, T>::Register(const key_t &key,
-                                              creator_t creator) {
+template <typename key_t, typename T, typename... args_t>
+inline void ObjectFactory<key_t, T, args_t...>::Register(const key_t &key,
+                                                         creator_t creator) {
+  if (_frozen) {
+    throw std::runtime_error("factory is frozen, cannot register key " +
+                             boost::lexical_cast<std::string>(key) + ".");
+  }
   (void)_objects.insert(typename assoc_map::value_type(key, creator)).second;
 }
 
-template <typename key_t, typename T>
+template <typename key_t, typename T, typename... args_t>
 template <typename obj_t>
-inline void ObjectFactory<key_t, T>::Register(const key_t &key) {
-  Register(key, create_policy_new<abstract_type, obj_t>);
+inline void ObjectFactory<key_t, T, args_t...>::Register(const key_t &key) {
+  Register(key, create_policy_new<abstract_type, obj_t, args_t...>);
+}
+
+template <typename key_t, typename T, typename... args_t>
+inline void ObjectFactory<key_t, T, args_t...>::Freeze() {
+  // the map is already sorted
+  _frozen_objects.assign(_objects.begin(), _objects.end());
+  _frozen = true;
 }
 
-template <typename key_t, typename T>
-inline T *ObjectFactory<key_t, T>::Create(const key_t &key) {
+template <typename key_t, typename T, typename... args_t>
+inline typename ObjectFactory<key_t, T, args_t...>::creator_t
+    ObjectFactory<key_t, T, args_t...>::Find(const key_t &key) const {
+  if (_frozen) {
+    auto it = std::lower_bound(
+        _frozen_objects.begin(), _frozen_objects.end(), key,
+        [](const std::pair<key_t, creator_t> &entry, const key_t &k) {
+          return entry.first < k;
+        });
+    if (it != _frozen_objects.end() && !(key < it->first)) {
+      return it->second;
+    }
+    return nullptr;
+  }
   typename assoc_map::const_iterator it(_objects.find(key));
-  if (it != _objects.end()) {
-    return (it->second)();
+  return (it != _objects.end()) ? it->second : nullptr;
+}
+
+template <typename key_t, typename T, typename... args_t>
+inline T *ObjectFactory<key_t, T, args_t...>::Create(const key_t &key,
+                                                     args_t... args) {
+  creator_t creator = Find(key);
+  if (creator != nullptr) {
+    return creator(std::forward<args_t>(args)...);
   } else {
     throw std::runtime_error(
         "factory key " + boost::lexical_cast<std::string>(key) + " not found.");
   }
 }
 
-template <typename key_t, typename T>
-inline bool ObjectFactory<key_t, T>::IsRegistered(const key_t &_id) const {
-  return (_objects.find(_id) != _objects.end());
+template <typename key_t, typename T, typename... args_t>
+inline bool ObjectFactory<key_t, T, args_t...>::IsRegistered(
+    const key_t &_id) const {
+  return Find(_id) != nullptr;
 }
 
 template <typename object_type>
@@ -122,12 +186,101 @@ class ObjectFactoryRegister {
  public:
   template <typename factory_type, typename key_type>
   ObjectFactoryRegister(factory_type &factory, key_type &key) {
-    factory.Register(
-        key,
-        &create_policy_new<typename factory_type::abstract_type, object_type>);
+    factory.template Register<object_type>(key);
   }
 };
 
+/**
+ * \brief keeps objects created by a factory for reuse
+ *
+ * Acquire hands out an object of the requested key, a released object is
+ * reused if available and only otherwise a new one is created with the given
+ * constructor arguments. The returned pointer gives the object back to the
+ * pool when it goes out of scope. A reused object is passed to the reset
+ * function together with the arguments of Acquire before it is handed out.
+ * Without a reset function objects are handed out again in the state they
+ * were released in, so classes used with such a pool have to reset
+ * themselves, e.g. in Initialize. The pool can be used from several threads
+ * and may be destroyed before the objects it handed out.
+ */
+template <typename key_t, typename T, typename... args_t>
+class ObjectPool {
+ private:
+  struct Storage {
+    std::mutex mutex;
+    std::map<key_t, std::vector<std::unique_ptr<T>>> free;
+  };
+
+ public:
+  using factory_type = ObjectFactory<key_t, T, args_t...>;
+  using reset_type = std::function<void(T &, args_t...)>;
+
+  class Deleter {
+   public:
+    Deleter() = default;
+    Deleter(std::weak_ptr<Storage> storage, key_t key)
+        : _storage(std::move(storage)), _key(std::move(key)) {}
+
+    void operator()(T *object) const {
+      std::unique_ptr<T> owned(object);
+      if (std::shared_ptr<Storage> storage = _storage.lock()) {
+        std::lock_guard<std::mutex> lock(storage->mutex);
+        storage->free[_key].push_back(std::move(owned));
+      }
+    }
+
+   private:
+    std::weak_ptr<Storage> _storage;
+    key_t _key;
+  };
+
+  using pointer = std::unique_ptr<T, Deleter>;
+
+  explicit ObjectPool(factory_type &factory, reset_type reset = reset_type())
+      : _factory(factory),
+        _reset(std::move(reset)),
+        _storage(std::make_shared<Storage>()) {}
+
+  pointer Acquire(const key_t &key, args_t... args) {
+    std::unique_ptr<T> reused;
+    {
+      std::lock_guard<std::mutex> lock(_storage->mutex);
+      auto it = _storage->free.find(key);
+      if (it != _storage->free.end() && !it->second.empty()) {
+        reused = std::move(it->second.back());
+        it->second.pop_back();
+      }
+    }
+    if (reused) {
+      // if reset throws, the object is destroyed instead of handed out
+      if (_reset) {
+        _reset(*reused, std::forward<args_t>(args)...);
+      }
+      return pointer(reused.release(), Deleter(_storage, key));
+    }
+    return pointer(_factory.Create(key, std::forward<args_t>(args)...),
+                   Deleter(_storage, key));
+  }
+
+  /// number of released objects waiting for reuse
+  Index Available(const key_t &key) const {
+    std::lock_guard<std::mutex> lock(_storage->mutex);
+    auto it = _storage->free.find(key);
+    return (it == _storage->free.end()) ? 0 : Index(it->second.size());
+  }
+
+  /// destroys all released objects
+  void Clear() {
+    std::lock_guard<std::mutex> lock(_storage->mutex);
+    _storage->free.clear();
+  }
+
+ private:
+  factory_type &_factory;
+  reset_type _reset;
+  std::shared_ptr<Storage> _storage;
+};
+
 }  // namespace tools
 }  // namespace votca
 
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_OPTIONSBINDER_H
+#define VOTCA_TOOLS_OPTIONSBINDER_H
+
+// Standard includes
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Local VOTCA includes
+#include "property.h"
+
+namespace votca {
+namespace tools {
+
+namespace detail {
+/// keeps a parameter out of template argument deduction
+template <typename T>
+struct NonDeduced {
+  using type = T;
+};
+}  // namespace detail
+
+/**
+ * \brief binds calculator options to the fields of a plain struct
+ *
+ * The keys of the options tree are registered once together with a pointer
+ * to the struct member they are stored in. Parse then looks up and converts
+ * every key a single time, so hot code can read the struct fields instead of
+ * doing string-keyed lookups in the Property tree.
+ *
+ * \code
+ * struct Options {
+ *   double cutoff;
+ *   std::string method;
+ * };
+ * OptionsBinder<Options> binder;
+ * binder.Bind("cutoff", &Options::cutoff).Bind("method", &Options::method);
+ * Options opt = binder.Parse(options);
+ * \endcode
+ */
+template <typename Options>
+class OptionsBinder {
+ public:
+  /**
+   * \brief binds a key, which has to exist in the options
+   * @param key identifier, "." steps down the hierarchy
+   * @param member member of Options the converted value is stored in
+   */
+  template <typename T>
+  OptionsBinder &Bind(const std::string &key, T Options::*member) {
+    _keys.push_back(key);
+    _bindings.push_back([key, member](const Property &p, Options &opt) {
+      opt.*member = p.get(key).as<T>();
+    });
+    return *this;
+  }
+
+  /**
+   * \brief binds a key, defaultvalue is used if the key does not exist
+   *
+   * The type is only taken from the member, so e.g. an integer literal can
+   * be the default of a double.
+   */
+  template <typename T>
+  OptionsBinder &Bind(
+      const std::string &key, T Options::*member,
+      const typename detail::NonDeduced<T>::type &defaultvalue) {
+    _keys.push_back(key);
+    _bindings.push_back(
+        [key, member, defaultvalue](const Property &p, Options &opt) {
+          opt.*member = p.ifExistsReturnElseReturnDefault<T>(key, defaultvalue);
+        });
+    return *this;
+  }
+
+  /**
+   * \brief converts all bound keys and stores them in opt
+   *
+   * Missing keys and failed conversions throw std::runtime_error naming
+   * the option.
+   */
+  void Parse(const Property &options, Options &opt) const {
+    for (const auto &binding : _bindings) {
+      binding(options, opt);
+    }
+  }
+
+  Options Parse(const Property &options) const {
+    Options opt;
+    Parse(options, opt);
+    return opt;
+  }
+
+  /**
+   * \brief keys which have been bound, in order of registration
+   */
+  const std::vector<std::string> &Keys() const { return _keys; }
+
+  /**
+   * \brief checks that every bound key exists in schema
+   *
+   * schema are the options of the calculator including all defaults, a
+   * misspelled key would otherwise silently fall back to the default of its
+   * binding. Throws std::runtime_error listing the unknown keys.
+   */
+  void CheckKeys(const Property &schema) const {
+    std::string unknown;
+    for (const std::string &key : _keys) {
+      if (!schema.exists(key)) {
+        unknown += (unknown.empty() ? "" : ", ") + key;
+      }
+    }
+    if (!unknown.empty()) {
+      throw std::runtime_error("Options " + unknown +
+                               " are bound but not defined in " +
+                               schema.name());
+    }
+  }
+
+ private:
+  std::vector<std::string> _keys;
+  std::vector<std::function<void(const Property &, Options &)>> _bindings;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_OPTIONSBINDER_H
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_PROFILER_H
+#define VOTCA_TOOLS_PROFILER_H
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Local VOTCA includes
+#include "synchronization.h"
+#include "types.h"
+#include "votca_tools_config.h"
+
+namespace votca {
+namespace tools {
+
+/**
+ * \brief Collects timings of nested regions and counters of the library
+ *
+ * Regions are timed with ScopedRegion objects, usually created with the
+ * VOTCA_PROFILE_REGION macro at the start of a function. A region opened
+ * while another one is active on the same thread becomes its child, so
+ * every thread builds a call tree. Every thread records into its own data,
+ * the per-thread trees are only merged when getRegions, WriteSummary or
+ * WriteChromeTrace are called.
+ *
+ * Profiling is off until Enable is called, a disabled region costs one
+ * relaxed atomic load. If the library is configured with
+ * -DENABLE_PROFILING=OFF, VOTCA_TOOLS_PROFILING is not defined and the macros
+ * compile to nothing.
+ *
+ * Region and counter names are not copied, they have to be string literals
+ * or otherwise outlive the Profiler.
+ */
+class Profiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// Aggregate of all calls of a region with the same call path
+  struct Region {
+    /// names from the outermost region down to this one
+    std::vector<std::string> path;
+    Index calls = 0;
+    /// times in seconds
+    double total = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+  };
+
+  struct Counter {
+    std::string name;
+    Index value = 0;
+  };
+
+  /// profiler shared by the whole library and Application
+  static Profiler& Global();
+
+  /// true if the library was built with profiling
+  static constexpr bool CompiledIn() {
+#ifdef VOTCA_TOOLS_PROFILING
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * \brief starts recording
+   * @param trace additionally keep every single call for WriteChromeTrace,
+   * at most max_events per thread
+   */
+  void Enable(bool trace = false, Index max_events = 1000000);
+  void Disable() { _enabled.store(false, std::memory_order_relaxed); }
+  bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+  /// removes all recorded data, should not be called while regions are open
+  void Reset();
+
+  /// adds n to the counter name
+  void Count(const char* name, Index n = 1);
+
+  /// regions of all threads merged by call path, parents before children
+  std::vector<Region> getRegions() const;
+  /// counters of all threads summed up and sorted by name
+  std::vector<Counter> getCounters() const;
+
+  /// prints the merged call tree and the counters
+  void WriteSummary(std::ostream& out) const;
+
+  /**
+   * \brief writes all recorded calls in the trace event format
+   *
+   * The file can be opened with chrome://tracing or https://ui.perfetto.dev,
+   * calls are only recorded if Enable was called with trace set.
+   */
+  void WriteChromeTrace(std::ostream& out) const;
+
+ private:
+  friend class ScopedRegion;
+  struct ThreadData;
+
+  Profiler() = default;
+  ThreadData& threadData_();
+  void enter_(ThreadData& data, const char* name);
+  void leave_(ThreadData& data, Clock::time_point start);
+
+  std::atomic<bool> _enabled{false};
+  std::atomic<bool> _trace{false};
+  std::atomic<Index> _max_events{0};
+  // tick count of the clock, as regions read it while Enable or Reset set it
+  std::atomic<Clock::rep> _start{Clock::now().time_since_epoch().count()};
+
+  mutable std::mutex _threads_mutex;
+  std::vector<std::unique_ptr<ThreadData>> _threads;
+};
+
+/**
+ * \brief Times the scope it lives in as a region of Profiler::Global()
+ *
+ * Nothing is recorded if the profiler is disabled when the object is
+ * created.
+ */
+class ScopedRegion {
+ public:
+  explicit ScopedRegion(const char* name) {
+    Profiler& profiler = Profiler::Global();
+    if (profiler.isEnabled()) {
+      _data = &profiler.threadData_();
+      profiler.enter_(*_data, name);
+      _start = Profiler::Clock::now();
+    }
+  }
+  ~ScopedRegion() {
+    if (_data != nullptr) {
+      Profiler::Global().leave_(*_data, _start);
+    }
+  }
+
+  ScopedRegion(const ScopedRegion&) = delete;
+  ScopedRegion& operator=(const ScopedRegion&) = delete;
+
+ private:
+  Profiler::ThreadData* _data = nullptr;
+  Profiler::Clock::time_point _start;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#define VOTCA_PROFILE_CONCAT_(a, b) a##b
+#define VOTCA_PROFILE_VARIABLE_(line) \
+  VOTCA_PROFILE_CONCAT_(votca_profile_region_, line)
+
+#ifdef VOTCA_TOOLS_PROFILING
+/// times the rest of the enclosing scope as region name
+#define VOTCA_PROFILE_REGION(name) \
+  ::votca::tools::ScopedRegion VOTCA_PROFILE_VARIABLE_(__LINE__)(name)
+/// adds n to the counter name if the profiler is enabled
+#define VOTCA_PROFILE_COUNT(name, n)                      \
+  do {                                                    \
+    if (::votca::tools::Profiler::Global().isEnabled()) { \
+      ::votca::tools::Profiler::Global().Count(name, n);  \
+    }                                                     \
+  } while (0)
+#else
+#define VOTCA_PROFILE_REGION(name) static_cast<void>(0)
+// n is not evaluated, but variables only kept for the count stay used
+#define VOTCA_PROFILE_COUNT(name, n) static_cast<void>(sizeof(n))
+#endif
+
+#endif  // VOTCA_TOOLS_PROFILER_H
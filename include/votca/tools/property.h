@@ -238,7 +238,8 @@ class Property {
   static Index getIOindex() { return IOindex; };
 
  private:
-  std::map<std::string, Index> _map;
+  // transparent comparator, so keys can be looked up with tokens
+  std::map<std::string, Index, std::less<>> _map;
   std::map<std::string, std::string> _attributes;
   std::vector<Property> _properties;
 
@@ -288,7 +289,9 @@ inline bool Property::as<bool>() const {
 
 template <typename T>
 inline T Property::as() const {
-  return lexical_cast<T>(_value, "wrong type in " + _path + "." + _name + "\n");
+  return lexical_cast<T>(_value, [this]() {
+    return "wrong type in " + _path + "." + _name + "\n";
+  });
 }
 
 template <typename T>
@@ -345,16 +348,14 @@ inline std::string Property::as<std::string>() const {
 template <>
 inline Eigen::VectorXd Property::as<Eigen::VectorXd>() const {
   std::vector<double> tmp;
-  Tokenizer tok(as<std::string>(), " ,");
-  tok.ConvertToVector<double>(tmp);
+  TokenizerView(_value, " ,\n\t\r").ConvertToVector<double>(tmp);
   return Eigen::Map<Eigen::VectorXd>(tmp.data(), tmp.size());
 }
 
 template <>
 inline Eigen::Vector3d Property::as<Eigen::Vector3d>() const {
   std::vector<double> tmp;
-  Tokenizer tok(as<std::string>(), " ,");
-  tok.ConvertToVector<double>(tmp);
+  TokenizerView(_value, " ,\n\t\r").ConvertToVector<double>(tmp);
   Eigen::Vector3d result;
   if (Index(tmp.size()) != result.size()) {
     throw std::runtime_error("Vector has " +
@@ -368,16 +369,14 @@ inline Eigen::Vector3d Property::as<Eigen::Vector3d>() const {
 template <>
 inline std::vector<Index> Property::as<std::vector<Index> >() const {
   std::vector<Index> tmp;
-  Tokenizer tok(as<std::string>(), " ,");
-  tok.ConvertToVector<Index>(tmp);
+  TokenizerView(_value, " ,\n\t\r").ConvertToVector<Index>(tmp);
   return tmp;
 }
 
 template <>
 inline std::vector<double> Property::as<std::vector<double> >() const {
   std::vector<double> tmp;
-  Tokenizer tok(as<std::string>(), " ,\n\t");
-  tok.ConvertToVector<double>(tmp);
+  TokenizerView(_value, " ,\n\t\r").ConvertToVector<double>(tmp);
   return tmp;
 }
 
@@ -410,9 +409,10 @@ inline T Property::getAttribute(const std::string &attribute) const {
   it = _attributes.find(attribute);
 
   if (it != _attributes.end()) {
-    return lexical_cast<T>(_attributes.at(attribute),
-                           "wrong type in attribute " + attribute +
-                               " of element " + _path + "." + _name + "\n");
+    return lexical_cast<T>(it->second, [&]() {
+      return "wrong type in attribute " + attribute + " of element " + _path +
+             "." + _name + "\n";
+    });
   } else {
     std::stringstream s;
     s << *this << std::endl;
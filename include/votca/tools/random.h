@@ -19,9 +19,14 @@
 #define VOTCA_TOOLS_RANDOM_H
 
 // Standard includes
+#include <array>
+#include <cstdint>
 #include <random>
+#include <stdexcept>
+#include <type_traits>
 
 // Local VOTCA includes
+#include "eigen.h"
 #include "types.h"
 
 namespace votca {
@@ -50,6 +55,196 @@ class Random {
   std::uniform_int_distribution<Index> _int_distribution;
 };
 
+/**
+ * \brief counter based random number engine Philox4x32-10
+ *
+ * The output is a pure function of the key, derived from the seed, and a
+ * 128 bit counter, see Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3" (SC11). The upper 64 bits of the counter select a stream, the
+ * lower 64 bits the position inside of it, so streams and positions can be
+ * chosen freely without any communication between threads. It fulfills the
+ * UniformRandomBitGenerator requirements and can be used with the std
+ * distributions.
+ */
+class Philox4x32 {
+ public:
+  using result_type = std::uint32_t;
+  using Block = std::array<std::uint32_t, 4>;
+
+  explicit Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0)
+      : _key{std::uint32_t(seed), std::uint32_t(seed >> 32)},
+        _stream(stream) {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+  result_type operator()() {
+    if (_index == 4) {
+      _buffer = Generate(_position++);
+      _index = 0;
+    }
+    return _buffer[_index++];
+  }
+
+  /// skips n outputs
+  void discard(std::uint64_t n) {
+    std::uint64_t available = 4 - _index;
+    if (n <= available) {
+      _index += unsigned(n);
+      return;
+    }
+    n -= available;
+    _position += n / 4;
+    _index = 4;
+    if (n % 4 != 0) {
+      _buffer = Generate(_position++);
+      _index = unsigned(n % 4);
+    }
+  }
+
+  /// drops the rest of the current block, the next output starts a new one
+  void AlignToBlock() { _index = 4; }
+
+  /// index of the next counter block
+  std::uint64_t getPosition() const { return _position; }
+  void setPosition(std::uint64_t position) {
+    _position = position;
+    _index = 4;
+  }
+  std::uint64_t getStream() const { return _stream; }
+
+  /// engine with the same key at the start of another stream
+  Philox4x32 Stream(std::uint64_t stream) const {
+    Philox4x32 result = *this;
+    result._stream = stream;
+    result.setPosition(0);
+    return result;
+  }
+
+  /// the four outputs belonging to counter block position of this stream
+  Block Generate(std::uint64_t position) const {
+    Block ctr = {std::uint32_t(position), std::uint32_t(position >> 32),
+                 std::uint32_t(_stream), std::uint32_t(_stream >> 32)};
+    std::array<std::uint32_t, 2> key = _key;
+    for (Index round = 0; round < 10; ++round) {
+      if (round > 0) {
+        key[0] += 0x9E3779B9u;
+        key[1] += 0xBB67AE85u;
+      }
+      std::uint64_t p0 = std::uint64_t(0xD2511F53u) * ctr[0];
+      std::uint64_t p1 = std::uint64_t(0xCD9E8D57u) * ctr[2];
+      ctr = {std::uint32_t(p1 >> 32) ^ ctr[1] ^ key[0], std::uint32_t(p1),
+             std::uint32_t(p0 >> 32) ^ ctr[3] ^ key[1], std::uint32_t(p0)};
+    }
+    return ctr;
+  }
+
+  bool operator==(const Philox4x32 &other) const {
+    return _key == other._key && _stream == other._stream &&
+           _position == other._position && _index == other._index;
+  }
+  bool operator!=(const Philox4x32 &other) const { return !(*this == other); }
+
+ private:
+  std::array<std::uint32_t, 2> _key;
+  std::uint64_t _stream;
+  std::uint64_t _position = 0;
+  Block _buffer = {0, 0, 0, 0};
+  unsigned _index = 4;
+};
+
+/**
+ * \brief reproducible random streams for parallel code
+ *
+ * Offers the interface of Random on top of Philox4x32. Substream derives
+ * independent, reproducible streams from the same master seed, e.g. one per
+ * job or per work chunk, so results do not depend on the number of threads
+ * or on the scheduling. The bulk fills are parallelized on the global
+ * ThreadPool and give the same numbers for any number of threads.
+ */
+class ParallelRandom {
+ public:
+  void init(Index seed) {
+    if (seed < 0) {
+      throw std::runtime_error("seed integer must be positive.");
+    }
+    _engine = Philox4x32(std::uint64_t(seed));
+    _has_normal = false;
+  }
+
+  /// independent stream with the given id, derived from this stream
+  ParallelRandom Substream(Index id) const;
+
+  // draws a random double from [0,1)
+  double rand_uniform() {
+    std::uint32_t hi = _engine();
+    std::uint32_t lo = _engine();
+    return ToDouble(hi, lo);
+  }
+  // draws a random double from the standard normal distribution
+  double rand_normal();
+  // sets maxint for a uniform integer distribution [0,maxint]
+  void setMaxInt(Index maxint) {
+    _int_distribution = std::uniform_int_distribution<Index>{0, maxint};
+  }
+  // draws from a uniform integer distribution [0,maxint]
+  Index rand_uniform_int() { return _int_distribution(_engine); }
+
+  /// fills data with uniform variates from [0,1)
+  void FillUniform(double *data, Index size);
+  /// fills data with standard normal variates
+  void FillNormal(double *data, Index size);
+
+  template <class Derived>
+  void FillUniform(Eigen::PlainObjectBase<Derived> &values) {
+    checkScalar_<Derived>();
+    FillUniform(values.data(), values.size());
+  }
+  /// expressions like blocks are filled through a temporary
+  template <class Derived>
+  void FillUniform(const Eigen::DenseBase<Derived> &values) {
+    checkScalar_<Derived>();
+    typename Derived::PlainObject tmp(values.rows(), values.cols());
+    FillUniform(tmp.data(), tmp.size());
+    const_cast<Derived &>(values.derived()) = tmp;
+  }
+  template <class Derived>
+  void FillNormal(Eigen::PlainObjectBase<Derived> &values) {
+    checkScalar_<Derived>();
+    FillNormal(values.data(), values.size());
+  }
+  template <class Derived>
+  void FillNormal(const Eigen::DenseBase<Derived> &values) {
+    checkScalar_<Derived>();
+    typename Derived::PlainObject tmp(values.rows(), values.cols());
+    FillNormal(tmp.data(), tmp.size());
+    const_cast<Derived &>(values.derived()) = tmp;
+  }
+
+  const Philox4x32 &getEngine() const { return _engine; }
+
+ private:
+  template <class Derived>
+  static void checkScalar_() {
+    static_assert(std::is_same<typename Derived::Scalar, double>::value,
+                  "ParallelRandom only fills double precision objects");
+  }
+
+  // 53 random bits from two outputs
+  static double ToDouble(std::uint32_t hi, std::uint32_t lo) {
+    return (double(hi >> 5) * 67108864.0 + double(lo >> 6)) *
+           (1.0 / 9007199254740992.0);
+  }
+
+  template <class Transform>
+  void Fill(double *data, Index size, Transform transform);
+
+  Philox4x32 _engine;
+  std::uniform_int_distribution<Index> _int_distribution;
+  double _normal = 0.0;
+  bool _has_normal = false;
+};
+
 }  // namespace tools
 }  // namespace votca
 
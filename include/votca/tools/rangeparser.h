@@ -19,11 +19,14 @@
 #define VOTCA_TOOLS_RANGEPARSER_H
 
 // Standard includes
+#include <atomic>
 #include <list>
+#include <mutex>
 #include <ostream>
 #include <string>
 
 // Local VOTCA includes
+#include "rangeset.h"
 #include "types.h"
 
 namespace votca {
@@ -33,15 +36,35 @@ namespace tools {
  * \brief RangeParser
  *
  * parse strings like min:step:max, not flexible enough yet to be really useful
+ *
+ * Iteration returns the values block by block in the order they were given.
+ * The blocks are also compiled into a RangeSet, which answers membership
+ * queries without iterating. The set is compiled by the first query after
+ * blocks were added, so adding many blocks stays linear. Queries may run
+ * from several threads at once.
  */
 class RangeParser {
  public:
   RangeParser();
+  RangeParser(const RangeParser &rp);
+  RangeParser &operator=(const RangeParser &rp);
 
   void Parse(std::string str);
 
   void Add(Index begin, Index end, Index stride = 1);
 
+  /// true if value is in one of the blocks
+  bool contains(Index value) const { return getRangeSet().contains(value); }
+  /// number of distinct values in all blocks
+  Index size() const { return getRangeSet().size(); }
+  /// compiled set of all values
+  const RangeSet &getRangeSet() const {
+    if (!_compiled.load(std::memory_order_acquire)) {
+      Compile();
+    }
+    return _set;
+  }
+
  private:
   struct block_t {
     block_t() = default;
@@ -77,14 +100,20 @@ class RangeParser {
 
  private:
   void ParseBlock(std::string str);
+  void Compile() const;
 
   std::list<block_t> _blocks;
+  mutable RangeSet _set;
+  mutable std::atomic<bool> _compiled{true};
+  /// serializes the lazy compilation of _set
+  mutable std::mutex _compile_mutex;
 
   friend std::ostream &operator<<(std::ostream &out, const RangeParser &rp);
 };
 
 inline void RangeParser::Add(Index begin, Index end, Index stride) {
   _blocks.push_back(block_t(begin, end, stride));
+  _compiled = false;
 }
 
 inline RangeParser::iterator RangeParser::begin() {
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_RANGESET_H
+#define VOTCA_TOOLS_RANGESET_H
+
+// Standard includes
+#include <vector>
+
+// Local VOTCA includes
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+/**
+ * \brief compiled set of integers given by strided ranges
+ *
+ * The ranges begin:stride:end are merged into sorted, non overlapping
+ * segments. Inside a segment the members repeat with a fixed period, so
+ * membership queries are a binary search over the segments followed by a
+ * lookup of the offset modulo the period. Overlapping ranges with different
+ * strides are resolved into the union of their residues.
+ */
+class RangeSet {
+ public:
+  struct Block {
+    Index begin;
+    Index end;
+    Index stride;
+  };
+
+  RangeSet() = default;
+  explicit RangeSet(const std::vector<Block> &blocks);
+
+  /// true if value is a member
+  bool contains(Index value) const;
+  /// number of distinct members, computed without iteration
+  Index size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  RangeSet Union(const RangeSet &other) const;
+  RangeSet Intersect(const RangeSet &other) const;
+
+  /// sorted distinct members
+  std::vector<Index> ToVector() const;
+  /// entry i is true if i is a member, for dense selections of [0,n)
+  std::vector<bool> ToMask(Index n) const;
+
+  /// strided blocks describing the set, sorted by segment
+  std::vector<Block> Blocks() const;
+
+ private:
+  struct Segment {
+    Index begin;
+    Index end;
+    Index period;
+    // sorted offsets from begin, all smaller than period
+    std::vector<Index> residues;
+  };
+
+  static Index CountSegment(const Segment &seg);
+  static std::vector<Block> Blocks(const Segment &seg);
+
+  std::vector<Segment> _segments;
+  Index _size = 0;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_RANGESET_H
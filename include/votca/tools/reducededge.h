@@ -20,6 +20,9 @@
 #ifndef VOTCA_TOOLS_REDUCEDEDGE_H
 #define VOTCA_TOOLS_REDUCEDEDGE_H
 
+// Standard includes
+#include <vector>
+
 // Local VOTCA includes
 #include "edge.h"
 
@@ -45,8 +48,10 @@ namespace tools {
  *
  * 1 - 4
  *
+ * The end points are held in a plain Edge, which can be retrieved with
+ * getEdge(), while the full chain is kept alongside it.
  **/
-class ReducedEdge : public Edge {
+class ReducedEdge {
 
  public:
   ReducedEdge() = default;
@@ -58,7 +63,28 @@ class ReducedEdge : public Edge {
       : ReducedEdge(std::vector<Index>{vertex1, vertex2}){};
 
   /// Returns a vector of vertices that constitute the edge
-  std::vector<Index> getChain() const { return vertices_; }
+  const std::vector<Index>& getChain() const { return vertices_; }
+
+  /// The edge formed by the two end points of the chain
+  const Edge& getEdge() const { return edge_; }
+
+  /// Allows a reduced edge to be used wherever its end point edge is expected
+  operator const Edge&() const { return edge_; }
+
+  /// Given one of the end points the other will be output
+  Index getOtherEndPoint(Index ver) const {
+    return edge_.getOtherEndPoint(ver);
+  }
+  /// grab the smaller end point
+  Index getEndPoint1() const { return edge_.getEndPoint1(); }
+  /// grab the larger end point
+  Index getEndPoint2() const { return edge_.getEndPoint2(); }
+
+  /// Determines if both end points of the chain are the same vertex
+  bool loop() const { return edge_.loop(); }
+
+  /// Determine if either end point is the vertex ID
+  bool contains(Index ID) const { return edge_.contains(ID); }
 
   /**
    * \brief Provided a vertex this method will determine if it exists within the
@@ -135,15 +161,12 @@ class ReducedEdge : public Edge {
   bool operator<=(const ReducedEdge& edge) const;
   bool operator>=(const ReducedEdge& edge) const;
 
-  using Edge::operator!=;
-  using Edge::operator==;
-  using Edge::operator<;
-  using Edge::operator>;
-  using Edge::operator<=;
-  using Edge::operator>=;
-
   /// Print the contents of the edge
   friend std::ostream& operator<<(std::ostream& os, const ReducedEdge& edge);
+
+ private:
+  Edge edge_;
+  std::vector<Index> vertices_;
 };
 
 }  // namespace tools
@@ -156,8 +179,7 @@ class hash<votca::tools::ReducedEdge> {
  public:
   size_t operator()(const votca::tools::ReducedEdge& ed) const {
     size_t value = 1;
-    auto vertices = ed.getChain();
-    for (auto vertex : vertices) {
+    for (auto vertex : ed.getChain()) {
       value += hash<size_t>()(static_cast<size_t>(vertex)) ^ value;
     }
     return value;
@@ -68,16 +68,31 @@ class ReducedGraph : public Graph {
    * 1 - 5
    *
    * Would be stored in the parent graph datastructure, the rest of the
-   * vertices are stored as a vector in the expanded_edges_ object
+   * vertices are stored as a chain. All chains are stored back to back in
+   * chain_vertices_, chain i occupies the range
+   * [chain_offsets_[i], chain_offsets_[i+1]). edge_chains_ lists the chains
+   * belonging to each edge of the reduced graph, they are only turned into
+   * edges when expandEdge is called.
    **/
-  std::unordered_map<Edge, std::vector<std::vector<Index>>> expanded_edges_;
+  std::vector<Index> chain_vertices_;
+  std::vector<Index> chain_offsets_{0};
+  std::unordered_map<Edge, std::vector<Index>> edge_chains_;
 
   void init_(std::vector<ReducedEdge> reduced_edges,
              std::unordered_map<Index, GraphNode> nodes);
 
+  /// stores the chain for edge unless an identical chain already exists
+  bool addChainIfNew_(const Edge& edge, const std::vector<Index>& chain,
+                      std::unordered_multimap<size_t, Index>& chain_hashes);
+
   // Junctions must be stored internally
   std::set<Index> junctions_;
 
+ protected:
+  /// Rings of the reduced graph are self loops and parallel edges, which the
+  /// cycle basis ignores, so the rings are found on the expanded graph
+  std::vector<std::vector<Index>> calcRings_() const override;
+
  public:
   ReducedGraph() = default;
 
@@ -138,6 +153,8 @@ class ReducedGraph : public Graph {
   std::vector<Index> getVerticesDegree(Index degree) const override;
 
   friend std::ostream& operator<<(std::ostream& os, const ReducedGraph graph);
+
+  friend class GraphSerializer;
 };
 
 }  // namespace tools
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_SYNCHRONIZATION_H
+#define VOTCA_TOOLS_SYNCHRONIZATION_H
+
+// Standard includes
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+// Local VOTCA includes
+#include "mutex.h"
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+/**
+ * \brief Locks a mutex for the lifetime of the object
+ *
+ * Works with every type providing lock() and unlock(), e.g. Mutex and
+ * HybridLock, so a lock can no longer be left locked by an early return or
+ * an exception.
+ */
+template <class Lockable = Mutex>
+class ScopedLock {
+ public:
+  explicit ScopedLock(Lockable& lock) : _lock(lock) { _lock.lock(); }
+  ~ScopedLock() { _lock.unlock(); }
+
+  ScopedLock(const ScopedLock&) = delete;
+  ScopedLock& operator=(const ScopedLock&) = delete;
+
+ private:
+  Lockable& _lock;
+};
+
+/**
+ * \brief Lock which spins for a while before putting the thread to sleep
+ *
+ * Short critical sections, e.g. incrementing a histogram bin, are usually
+ * left before the spinning ends, so no system call is needed. If the lock is
+ * held longer, waiting threads sleep on a condition variable instead of
+ * burning cpu time.
+ */
+class HybridLock {
+ public:
+  void lock();
+  void unlock();
+  bool try_lock() {
+    return !_locked.load(std::memory_order_relaxed) &&
+           !_locked.exchange(true, std::memory_order_acquire);
+  }
+
+ private:
+  static constexpr Index spin_iterations = 1000;
+  std::atomic<bool> _locked{false};
+  std::atomic<Index> _sleepers{0};
+  std::mutex _mutex;
+  std::condition_variable _wakeup;
+};
+
+/**
+ * \brief Lock for data which is read often and written rarely
+ *
+ * Any number of ReadLocks can be held at the same time, a WriteLock is
+ * exclusive.
+ */
+using ReadWriteLock = std::shared_timed_mutex;
+using ReadLock = std::shared_lock<ReadWriteLock>;
+using WriteLock = std::unique_lock<ReadWriteLock>;
+
+/**
+ * \brief index of the shard the calling thread should use
+ *
+ * Threads are assigned round robin on their first call, so up to nshards
+ * threads never share a shard.
+ */
+Index ThreadShard(Index nshards);
+
+/**
+ * \brief Counter which threads can increment without contention
+ *
+ * Every shard sits on its own cache line and every thread increments its own
+ * shard, value() sums all shards up. Increments are exact, but value() is
+ * only a snapshot while other threads are still counting.
+ */
+class ShardedCounter {
+ public:
+  explicit ShardedCounter(Index nshards = DefaultShards());
+
+  void add(Index n = 1) {
+    _shards[ThreadShard(Index(_shards.size()))].value.fetch_add(
+        n, std::memory_order_relaxed);
+  }
+
+  Index value() const;
+
+  void reset();
+
+  /// twice the number of cores to make collisions of threads unlikely
+  static Index DefaultShards();
+
+ private:
+  struct alignas(64) Shard {
+    std::atomic<Index> value{0};
+  };
+  std::vector<Shard> _shards;
+};
+
+/**
+ * \brief Accumulator with one partial result per shard
+ *
+ * add() combines a value into the partial result of the shard of the
+ * calling thread, value() combines all partial results. The combine
+ * operation has to be associative and commutative, by default it is
+ * operator+.
+ */
+template <class T>
+class ShardedAccumulator {
+ public:
+  using Combine = std::function<T(const T&, const T&)>;
+
+  explicit ShardedAccumulator(
+      const T& init = T(), Combine combine = std::plus<T>(),
+      Index nshards = ShardedCounter::DefaultShards())
+      : _init(init), _combine(std::move(combine)), _shards(nshards) {
+    for (Shard& shard : _shards) {
+      shard.value = _init;
+    }
+  }
+
+  void add(const T& value) {
+    Shard& shard = _shards[ThreadShard(Index(_shards.size()))];
+    ScopedLock<HybridLock> lock(shard.lock);
+    shard.value = _combine(shard.value, value);
+  }
+
+  T value() {
+    T result = _init;
+    for (Shard& shard : _shards) {
+      ScopedLock<HybridLock> lock(shard.lock);
+      result = _combine(result, shard.value);
+    }
+    return result;
+  }
+
+ private:
+  struct alignas(64) Shard {
+    HybridLock lock;
+    T value;
+  };
+  T _init;
+  Combine _combine;
+  std::vector<Shard> _shards;
+};
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_SYNCHRONIZATION_H
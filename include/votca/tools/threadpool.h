@@ -0,0 +1,250 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef VOTCA_TOOLS_THREADPOOL_H
+#define VOTCA_TOOLS_THREADPOOL_H
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Local VOTCA includes
+#include "types.h"
+
+namespace votca {
+namespace tools {
+
+/**
+ * \brief Pool of worker threads with work stealing
+ *
+ * A pool with nthreads threads starts nthreads-1 workers, the thread calling
+ * parallel_for takes part in the work. Every worker has its own task queue,
+ * tasks submitted from a worker go to its own queue and idle workers steal
+ * from the queues of the others. Tasks submitted from outside of the pool
+ * are distributed round robin.
+ *
+ * ThreadPool::Global() is shared by the whole library, so that independent
+ * parallel regions do not oversubscribe the cores.
+ */
+class ThreadPool {
+ public:
+  explicit ThreadPool(Index nthreads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// number of threads working on a parallel_for, including the caller
+  Index size() const { return Index(_workers.size()) + 1; }
+
+  /**
+   * \brief Changes the number of threads
+   *
+   * Waits until all submitted tasks are finished, so it must not be called
+   * from a task of this pool. The queues are rebuilt without locking, so no
+   * other thread may use the pool meanwhile. The library never resizes
+   * Global() by itself, use the max_threads argument of parallel_for to
+   * limit a single call.
+   */
+  void Resize(Index nthreads);
+
+  /**
+   * \brief Index of the calling thread in this pool
+   *
+   * Workers have the indices 1 ... size()-1, all other threads get 0.
+   * Can be used to index per thread scratch storage, see WorkerLocal.
+   */
+  Index WorkerIndex() const;
+
+  /**
+   * \brief Schedules f() for execution and returns a future to its result
+   *
+   * If the pool has no workers, f is executed immediately.
+   */
+  template <class F>
+  std::future<typename std::result_of<F()>::type> submit(F f) {
+    using R = typename std::result_of<F()>::type;
+    auto task = std::make_shared<std::packaged_task<R()>>(std::move(f));
+    std::future<R> result = task->get_future();
+    if (_workers.empty()) {
+      (*task)();
+    } else {
+      push([task]() { (*task)(); });
+    }
+    return result;
+  }
+
+  /**
+   * \brief Calls f(i) for every i in [begin,end)
+   *
+   * The range is split into chunks of chunksize indices, which are picked up
+   * dynamically by the workers and the calling thread. If chunksize is 0 the
+   * range is split into 4 chunks per thread. max_threads limits the number of
+   * threads working on this call, including the caller, 0 uses the whole
+   * pool. The size of the pool is not changed. The first exception thrown by f
+   * is rethrown after all chunks are finished. Nested calls from inside a
+   * task are allowed.
+   *
+   * The calling thread only ever executes chunks of its own call, never tasks
+   * of other parallel regions. So several threads outside of the pool, which
+   * all get WorkerIndex() 0, can call parallel_for at the same time, each
+   * with its own WorkerLocal. Once all chunks are taken the caller sleeps
+   * until the chunks still running are finished, tasks which start later find
+   * no work and return immediately.
+   */
+  template <class F>
+  void parallel_for(Index begin, Index end, F f, Index chunksize = 0,
+                    Index max_threads = 0);
+
+  /// pool shared by all of libtools, starts with one thread per core
+  static ThreadPool& Global();
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void start(Index nthreads);
+  void stop();
+  void push(std::function<void()> task);
+  bool pop(Index worker, std::function<void()>& task);
+  void work(Index worker);
+
+  std::vector<std::thread> _workers;
+  // queue 0 receives tasks submitted from outside the pool
+  std::vector<std::unique_ptr<Queue>> _queues;
+  std::atomic<Index> _pending{0};
+  std::atomic<Index> _next_queue{0};
+  bool _stop = false;
+  std::mutex _sleep_mutex;
+  std::condition_variable _wakeup;
+};
+
+/**
+ * \brief One instance of T per thread of a ThreadPool
+ *
+ * Provides scratch storage for parallel_for, local() returns the instance of
+ * the calling thread. After the parallel region the instances can be
+ * iterated over to reduce them.
+ */
+template <class T>
+class WorkerLocal {
+ public:
+  explicit WorkerLocal(const ThreadPool& pool, const T& init = T())
+      : _pool(pool), _data(pool.size(), init) {}
+
+  T& local() { return _data[_pool.WorkerIndex()]; }
+
+  typename std::vector<T>::iterator begin() { return _data.begin(); }
+  typename std::vector<T>::iterator end() { return _data.end(); }
+
+ private:
+  const ThreadPool& _pool;
+  std::vector<T> _data;
+};
+
+template <class F>
+void ThreadPool::parallel_for(Index begin, Index end, F f, Index chunksize,
+                              Index max_threads) {
+  if (end <= begin) {
+    return;
+  }
+  Index nthreads = (max_threads > 0) ? std::min(max_threads, size()) : size();
+  Index range = end - begin;
+  if (chunksize <= 0) {
+    chunksize = std::max(Index(1), range / (4 * nthreads));
+  }
+  Index nchunks = (range + chunksize - 1) / chunksize;
+  if (nthreads == 1 || nchunks == 1) {
+    for (Index i = begin; i < end; i++) {
+      f(i);
+    }
+    return;
+  }
+
+  // tasks may start after parallel_for has returned, so everything they
+  // touch before finding that no chunk is left lives on the heap
+  struct Region {
+    std::atomic<Index> next_chunk{0};
+    std::atomic<Index> finished_chunks{0};
+    std::exception_ptr error = nullptr;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+  auto region = std::make_shared<Region>();
+  F* body = &f;
+  auto run_chunks = [region, body, begin, end, chunksize, nchunks]() {
+    Index chunk;
+    while ((chunk = region->next_chunk.fetch_add(1)) < nchunks) {
+      Index start = begin + chunk * chunksize;
+      Index stop = std::min(end, start + chunksize);
+      try {
+        for (Index i = start; i < stop; i++) {
+          (*body)(i);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(region->mutex);
+        if (!region->error) {
+          region->error = std::current_exception();
+        }
+      }
+      if (region->finished_chunks.fetch_add(1, std::memory_order_acq_rel) ==
+          nchunks - 1) {
+        // taking the lock makes sure the caller is either asleep or has not
+        // checked the count yet
+        std::lock_guard<std::mutex> lock(region->mutex);
+        region->done.notify_one();
+      }
+    }
+  };
+
+  Index ntasks = std::min(nchunks, nthreads) - 1;
+  for (Index i = 0; i < ntasks; i++) {
+    push(run_chunks);
+  }
+  run_chunks();
+  // all chunks are taken, the threads working on the remaining ones make
+  // progress without our help
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(region->mutex);
+    region->done.wait(lock, [&region, nchunks]() {
+      return region->finished_chunks.load(std::memory_order_acquire) ==
+             nchunks;
+    });
+    error = region->error;
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace tools
+}  // namespace votca
+
+#endif  // VOTCA_TOOLS_THREADPOOL_H
@@ -14,30 +14,176 @@
  * limitations under the License.
  *
  */
-
 #ifndef VOTCA_TOOLS_TOKENIZER_H
 #define VOTCA_TOOLS_TOKENIZER_H
 
 // Standard includes
+#include <bitset>
+#include <cstddef>
+#include <iterator>
 #include <string>
 #include <vector>
 
 // Third party includes
-#include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
+#include <boost/utility/string_ref.hpp>
+
+// Local VOTCA includes
+#include "lexical_cast.h"
 
 namespace votca {
 namespace tools {
 
+/**
+ * \brief set of separator characters used by the tokenizers
+ */
+using SeparatorSet = std::bitset<256>;
+
+SeparatorSet MakeSeparatorSet(const char *separators);
+
+/**
+ * \brief break a borrowed string into words without copying it
+ *
+ * The tokens are boost::string_ref objects pointing into the original
+ * buffer, so the buffer has to outlive the view and all tokens taken from
+ * it. Consecutive separators are collapsed and no empty tokens are returned,
+ * which matches the behaviour of Tokenizer.
+ */
+class TokenizerView {
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = boost::string_ref;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const boost::string_ref *;
+    using reference = const boost::string_ref &;
+
+    iterator() = default;
+
+    reference operator*() const { return _token; }
+    pointer operator->() const { return &_token; }
+
+    iterator &operator++() {
+      Advance(_token.end());
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const iterator &other) const {
+      return _token.data() == other._token.data();
+    }
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+
+   private:
+    iterator(const char *pos, const char *end, const SeparatorSet *separators)
+        : _end(end), _separators(separators) {
+      Advance(pos);
+    }
+
+    bool IsSeparator(char c) const {
+      return (*_separators)[static_cast<unsigned char>(c)];
+    }
+
+    void Advance(const char *pos) {
+      while (pos != _end && IsSeparator(*pos)) {
+        ++pos;
+      }
+      if (pos == _end) {
+        _token = boost::string_ref();
+        return;
+      }
+      const char *start = pos;
+      while (pos != _end && !IsSeparator(*pos)) {
+        ++pos;
+      }
+      _token = boost::string_ref(start, std::size_t(pos - start));
+    }
+
+    boost::string_ref _token;
+    const char *_end = nullptr;
+    const SeparatorSet *_separators = nullptr;
+
+    friend class TokenizerView;
+    friend class Tokenizer;
+  };
+
+  TokenizerView(boost::string_ref str, const char *separators)
+      : _str(str), _separators(MakeSeparatorSet(separators)) {}
+
+  iterator begin() const {
+    return iterator(_str.begin(), _str.end(), &_separators);
+  }
+  iterator end() const { return iterator(); }
+
+  /**
+   * \brief appends all tokens to v, the tokens still point into the buffer
+   */
+  void ToVector(std::vector<boost::string_ref> &v) const {
+    v.insert(v.end(), begin(), end());
+  }
+
+  /**
+   * \brief converts all tokens and stores them in v
+   *
+   * The content of v is replaced, its capacity is reused.
+   */
+  template <typename T>
+  void ConvertToVector(std::vector<T> &v) const {
+    v.clear();
+    for (boost::string_ref token : *this) {
+      v.push_back(ConvertToken<T>(token));
+    }
+  }
+
+ private:
+  boost::string_ref _str;
+  SeparatorSet _separators;
+};
+
 /**
  * \brief break string into words
  *
- * This class wraps boost::tokenizer to break a string into words. A list of
- * delimeters can be freely choosen.
+ * This class owns a copy of the string and breaks it into words. A list of
+ * delimeters can be freely choosen. It uses the same scanner as
+ * TokenizerView, but the iterator returns std::string words.
  */
 class Tokenizer {
  public:
-  using iterator = boost::tokenizer<boost::char_separator<char>>::iterator;
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string *;
+    using reference = std::string;
+
+    iterator() = default;
+
+    std::string operator*() const { return _it->to_string(); }
+
+    iterator &operator++() {
+      ++_it;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++_it;
+      return tmp;
+    }
+
+    bool operator==(const iterator &other) const { return _it == other._it; }
+    bool operator!=(const iterator &other) const { return _it != other._it; }
+
+   private:
+    explicit iterator(TokenizerView::iterator it) : _it(it) {}
+    TokenizerView::iterator _it;
+
+    friend class Tokenizer;
+  };
 
   /**
    * \brief startup tokenization
@@ -48,11 +194,8 @@ class Tokenizer {
    * interface or directly transferred to a vector ToVector of ConvertToVector.
    */
 
-  Tokenizer(const std::string &str, const char *separators) : _str(str) {
-    boost::char_separator<char> sep(separators);
-    tok = std::make_unique<boost::tokenizer<boost::char_separator<char>>>(_str,
-                                                                          sep);
-  }
+  Tokenizer(const std::string &str, const char *separators)
+      : _str(str), _separators(MakeSeparatorSet(separators)) {}
   Tokenizer(const std::string &str, const std::string &separators)
       : Tokenizer(str, separators.c_str()){};
 
@@ -60,12 +203,15 @@ class Tokenizer {
    * \brief iterator to first element
    * @return begin iterator
    */
-  iterator begin() { return tok->begin(); }
+  iterator begin() const {
+    return iterator(TokenizerView::iterator(
+        _str.data(), _str.data() + _str.size(), &_separators));
+  }
   /**
    * \brief end iterator
    * @return end iterator
    */
-  iterator end() { return tok->end(); }
+  iterator end() const { return iterator(); }
 
   /**
    * \brief store all words in a vector of strings.
@@ -73,17 +219,15 @@ class Tokenizer {
    *
    * This class appends all words to a vector of strings.
    */
-  void ToVector(std::vector<std::string> &v) {
+  void ToVector(std::vector<std::string> &v) const {
     for (iterator iter = begin(); iter != end(); ++iter) {
       v.push_back(*iter);
     }
   }
 
-  std::vector<std::string> ToVector() {
+  std::vector<std::string> ToVector() const {
     std::vector<std::string> result;
-    for (iterator iter = begin(); iter != end(); ++iter) {
-      result.push_back(*iter);
-    }
+    ToVector(result);
     return result;
   }
 
@@ -91,24 +235,21 @@ class Tokenizer {
    * \brief store all words in a vector with type conversion.
    * @param v storage vector
    *
-   * This class appends all words to a vector of arbitrary type (e.g. double)
-   * and also does type conversion.
+   * This class replaces the content of v by all words converted to an
+   * arbitrary type (e.g. double). Numbers are converted directly from the
+   * stored string without intermediate copies.
    */
   template <typename T>
-  void ConvertToVector(std::vector<T> &v) {
-    std::vector<std::string> tmp;
-    ToVector(tmp);
-    v.resize(tmp.size());
-    typename std::vector<T>::iterator viter = v.begin();
-    typename std::vector<std::string>::iterator iter;
-    for (iter = tmp.begin(); iter != tmp.end(); ++iter, ++viter) {
-      *viter = boost::lexical_cast<T, std::string>(*iter);
+  void ConvertToVector(std::vector<T> &v) const {
+    v.clear();
+    for (iterator iter = begin(); iter != end(); ++iter) {
+      v.push_back(ConvertToken<T>(*iter._it));
     }
   }
 
  private:
-  std::unique_ptr<boost::tokenizer<boost::char_separator<char>>> tok;
   std::string _str;
+  SeparatorSet _separators;
 };
 
 // Matches a string against a wildcard string such as &quot;*.*&quot; or
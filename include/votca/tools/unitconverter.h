@@ -19,7 +19,15 @@
 #define VOTCA_TOOLS_UNITCONVERTER_H
 
 // Standard includes
+#include <algorithm>
 #include <map>
+#include <stdexcept>
+#include <type_traits>
+
+// Local VOTCA includes
+#include "eigen.h"
+#include "threadpool.h"
+#include "types.h"
 
 namespace votca {
 namespace tools {
@@ -286,6 +294,76 @@ class UnitConverter {
                            const MolarForceUnit& to) const noexcept {
     return (getMolarForceValue_(to)) / (getMolarForceValue_(from));
   }
+
+  /// conversion factor evaluated at compile time, e.g.
+  /// factor<DistanceUnit, DistanceUnit::nanometers, DistanceUnit::bohr>()
+  template <class Unit, Unit from, Unit to>
+  static constexpr double factor() noexcept {
+    return UnitConverter().convert(from, to);
+  }
+
+  /**
+   * \brief converts size values starting at data in place
+   *
+   * The values are scaled with vectorized Eigen expressions, large arrays
+   * are split in blocks which are processed on ThreadPool::Global().
+   */
+  template <class Unit>
+  void convertInPlace(const Unit& from, const Unit& to, double* data,
+                      Index size) const {
+    scaleInPlace_(convert(from, to), data, size);
+  }
+
+  /// converts all coefficients of an Eigen object with contiguous storage
+  template <class Unit, class Derived>
+  void convertInPlace(const Unit& from, const Unit& to,
+                      const Eigen::DenseBase<Derived>& values) const {
+    convertInPlace(from, to, contiguousData_(values), values.size());
+  }
+
+  /// same as above with the units known at compile time
+  template <class Unit, Unit from, Unit to>
+  void convertInPlace(double* data, Index size) const {
+    constexpr double scale = factor<Unit, from, to>();
+    scaleInPlace_(scale, data, size);
+  }
+
+  template <class Unit, Unit from, Unit to, class Derived>
+  void convertInPlace(const Eigen::DenseBase<Derived>& values) const {
+    convertInPlace<Unit, from, to>(contiguousData_(values), values.size());
+  }
+
+ private:
+  // Eigen idiom to accept temporary expressions like blocks as output
+  template <class Derived>
+  static double* contiguousData_(const Eigen::DenseBase<Derived>& values) {
+    static_assert(
+        std::is_same<typename Derived::Scalar, double>::value,
+        "UnitConverter::convertInPlace only supports double precision");
+    Derived& output = const_cast<Derived&>(values.derived());
+    if (output.innerStride() != 1 ||
+        (output.outerStride() != output.innerSize() &&
+         output.outerSize() > 1)) {
+      throw std::runtime_error(
+          "UnitConverter::convertInPlace needs contiguous storage");
+    }
+    return output.data();
+  }
+
+  static void scaleInPlace_(double scale, double* data, Index size) {
+    // blocks of 1 MB stay in cache and are enough work for a thread
+    constexpr Index blocksize = 1 << 17;
+    if (size <= blocksize) {
+      Eigen::Map<Eigen::ArrayXd>(data, size) *= scale;
+      return;
+    }
+    Index nblocks = (size + blocksize - 1) / blocksize;
+    ThreadPool::Global().parallel_for(0, nblocks, [=](Index block) {
+      Index start = block * blocksize;
+      Index length = std::min(blocksize, size - start);
+      Eigen::Map<Eigen::ArrayXd>(data + start, length) *= scale;
+    });
+  }
 };
 }  // namespace tools
 }  // namespace votca
@@ -16,6 +16,7 @@
  */
 
 // Standard includes
+#include <fstream>
 #include <iostream>
 
 // Third party includes
@@ -26,6 +27,7 @@
 // Local VOTCA includes
 #include "votca/tools/application.h"
 #include "votca/tools/globals.h"
+#include "votca/tools/profiler.h"
 #include "votca/tools/propertyiomanipulator.h"
 #include "votca/tools/version.h"
 
@@ -100,12 +102,18 @@ void Application::ShowTEXPage(std::ostream &out) {
 }
 
 int Application::Exec(int argc, char **argv) {
+  int result = 0;
   try {
     //_continue_execution = true;
     AddProgramOptions()("help,h", "  display this help and exit");
     AddProgramOptions()("verbose", "  be loud and noisy");
     AddProgramOptions()("verbose1", "  be very loud and noisy");
     AddProgramOptions()("verbose2,v", "  be extremly loud and noisy");
+    AddProgramOptions()(
+        "profile",
+        boost::program_options::value<string>()->implicit_value("summary"),
+        "  time the library and print a summary on exit, or write a Chrome "
+        "trace in JSON format to the given file");
     AddProgramOptions("Hidden")("man", "  output man-formatted manual pages");
     AddProgramOptions("Hidden")("tex", "  output tex-formatted manual pages");
 
@@ -140,21 +148,50 @@ int Application::Exec(int argc, char **argv) {
       return 0;
     }
 
+    if (_op_vm.count("profile")) {
+      _profile_output = _op_vm["profile"].as<string>();
+      Profiler::Global().Enable(_profile_output != "summary");
+      if (!Profiler::CompiledIn()) {
+        cerr << "votca_tools was built without profiling, --profile only "
+                "times the whole run\n";
+      }
+    }
+
     if (!EvaluateOptions()) {
       ShowHelpText(cout);
       return -1;
     }
 
     if (_continue_execution) {
+      ScopedRegion region("Application::Run");
       Run();
     } else {
       cout << "nothing to be done - stopping here\n";
     }
   } catch (std::exception &error) {
     cerr << "an error occurred:\n" << error.what() << endl;
-    return -1;
+    result = -1;
+  }
+  WriteProfile();
+  return result;
+}
+
+void Application::WriteProfile() {
+  if (_profile_output.empty()) {
+    return;
+  }
+  Profiler &profiler = Profiler::Global();
+  profiler.Disable();
+  if (_profile_output == "summary") {
+    profiler.WriteSummary(clog);
+    return;
+  }
+  ofstream out(_profile_output);
+  if (!out) {
+    cerr << "could not write profile to " << _profile_output << endl;
+    return;
   }
-  return 0;
+  profiler.WriteChromeTrace(out);
 }
 
 boost::program_options::options_description_easy_init
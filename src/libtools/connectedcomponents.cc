@@ -0,0 +1,222 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+// Local VOTCA includes
+#include "votca/tools/connectedcomponents.h"
+#include "votca/tools/graph.h"
+#include "votca/tools/graphnode.h"
+#include "votca/tools/threadpool.h"
+
+namespace votca {
+namespace tools {
+
+using namespace std;
+
+namespace {
+
+// Below this number of edges the threads cost more than they save
+const Index min_parallel_edges = 1 << 16;
+
+/**
+ * Union find over atomic parent links. A root is only ever linked below a
+ * vertex with a smaller index, so the links can not form a cycle and
+ * concurrent unions need no lock, a failed compare and swap simply retries
+ * from the new roots. Every root is the smallest index of its set.
+ */
+class AtomicUnionFind {
+ public:
+  explicit AtomicUnionFind(Index size) : parent_(size) {
+    for (Index i = 0; i < size; ++i) {
+      parent_[i].store(i, memory_order_relaxed);
+    }
+  }
+
+  Index find(Index vertex) {
+    while (true) {
+      Index parent = parent_[vertex].load(memory_order_relaxed);
+      if (parent == vertex) {
+        return vertex;
+      }
+      Index grand_parent = parent_[parent].load(memory_order_relaxed);
+      if (parent != grand_parent) {
+        // path halving, a parent is only ever replaced by one of its
+        // ancestors so a lost race is harmless
+        parent_[vertex].compare_exchange_weak(parent, grand_parent,
+                                              memory_order_relaxed);
+      }
+      vertex = grand_parent;
+    }
+  }
+
+  void unite(Index vertex1, Index vertex2) {
+    while (true) {
+      vertex1 = find(vertex1);
+      vertex2 = find(vertex2);
+      if (vertex1 == vertex2) {
+        return;
+      }
+      if (vertex1 < vertex2) {
+        swap(vertex1, vertex2);
+      }
+      Index expected = vertex1;
+      if (parent_[vertex1].compare_exchange_strong(expected, vertex2,
+                                                   memory_order_acq_rel)) {
+        return;
+      }
+    }
+  }
+
+ private:
+  vector<atomic<Index>> parent_;
+};
+}  // namespace
+
+SubGraphView::VertexRange SubGraphView::getVertices() const {
+  auto begin = components_->component_vertices_.begin();
+  return VertexRange(begin + components_->vertex_offsets_[component_],
+                     begin + components_->vertex_offsets_[component_ + 1]);
+}
+
+SubGraphView::EdgeRange SubGraphView::getEdges() const {
+  auto begin = components_->component_edges_.begin();
+  return EdgeRange(begin + components_->edge_offsets_[component_],
+                   begin + components_->edge_offsets_[component_ + 1]);
+}
+
+Graph SubGraphView::toGraph(const Graph& graph) const {
+  unordered_map<Index, GraphNode> nodes;
+  for (Index vertex : getVertices()) {
+    nodes[vertex] = graph.getNode(vertex);
+  }
+  EdgeRange edges = getEdges();
+  return Graph(vector<Edge>(edges.begin(), edges.end()), nodes);
+}
+
+ConnectedComponents::ConnectedComponents(const Graph& graph, bool parallel)
+    : vertices_(graph.getVertices()) {
+  label_(graph.getEdges(), parallel);
+}
+
+ConnectedComponents::ConnectedComponents(vector<Index> vertices,
+                                         const vector<Edge>& edges,
+                                         bool parallel)
+    : vertices_(std::move(vertices)) {
+  label_(edges, parallel);
+}
+
+void ConnectedComponents::label_(const vector<Edge>& edges, bool parallel) {
+  sort(vertices_.begin(), vertices_.end());
+  vertices_.erase(unique(vertices_.begin(), vertices_.end()), vertices_.end());
+  Index nvertices = Index(vertices_.size());
+  compact_index_.reserve(vertices_.size());
+  for (Index i = 0; i < nvertices; ++i) {
+    compact_index_[vertices_[i]] = i;
+  }
+
+  auto compact = [&](Index vertex) {
+    auto it = compact_index_.find(vertex);
+    if (it == compact_index_.end()) {
+      throw runtime_error("ConnectedComponents: edge vertex " +
+                          to_string(vertex) + " is not in the vertex list");
+    }
+    return it->second;
+  };
+
+  AtomicUnionFind union_find(nvertices);
+  Index nedges = Index(edges.size());
+  auto unite = [&](Index i) {
+    union_find.unite(compact(edges[i].getEndPoint1()),
+                     compact(edges[i].getEndPoint2()));
+  };
+  ThreadPool& pool = ThreadPool::Global();
+  if (parallel && nedges >= min_parallel_edges && pool.size() > 1) {
+    pool.parallel_for(0, nedges, unite);
+  } else {
+    for (Index i = 0; i < nedges; ++i) {
+      unite(i);
+    }
+  }
+
+  // roots are the smallest vertex of their component, so numbering them in
+  // vertex order numbers the components by their smallest vertex
+  vertex_component_.assign(vertices_.size(), -1);
+  vector<Index> vertex_counts;
+  for (Index i = 0; i < nvertices; ++i) {
+    Index root = union_find.find(i);
+    if (root == i) {
+      vertex_component_[i] = Index(vertex_counts.size());
+      vertex_counts.push_back(0);
+    } else {
+      vertex_component_[i] = vertex_component_[root];
+    }
+    ++vertex_counts[vertex_component_[i]];
+  }
+
+  // counting sort of the vertices and edges by component
+  Index ncomponents = Index(vertex_counts.size());
+  vertex_offsets_.assign(ncomponents + 1, 0);
+  for (Index c = 0; c < ncomponents; ++c) {
+    vertex_offsets_[c + 1] = vertex_offsets_[c] + vertex_counts[c];
+  }
+  component_vertices_.resize(vertices_.size());
+  vector<Index> position(vertex_offsets_.begin(), vertex_offsets_.end() - 1);
+  for (Index i = 0; i < nvertices; ++i) {
+    component_vertices_[position[vertex_component_[i]]++] = vertices_[i];
+  }
+
+  vector<Index> edge_component(edges.size());
+  edge_offsets_.assign(ncomponents + 1, 0);
+  for (Index i = 0; i < nedges; ++i) {
+    edge_component[i] = vertex_component_[compact(edges[i].getEndPoint1())];
+    ++edge_offsets_[edge_component[i] + 1];
+  }
+  for (Index c = 0; c < ncomponents; ++c) {
+    edge_offsets_[c + 1] += edge_offsets_[c];
+  }
+  component_edges_.resize(edges.size());
+  position.assign(edge_offsets_.begin(), edge_offsets_.end() - 1);
+  for (Index i = 0; i < nedges; ++i) {
+    component_edges_[position[edge_component[i]]++] = edges[i];
+  }
+}
+
+Index ConnectedComponents::getComponent(Index vertex) const {
+  auto it = compact_index_.find(vertex);
+  if (it == compact_index_.end()) {
+    throw runtime_error("ConnectedComponents: vertex " + to_string(vertex) +
+                        " is not part of the graph");
+  }
+  return vertex_component_[it->second];
+}
+
+SubGraphView ConnectedComponents::getSubGraph(Index component) const {
+  if (component < 0 || component >= size()) {
+    throw runtime_error("ConnectedComponents: component " +
+                        to_string(component) + " does not exist");
+  }
+  return SubGraphView(*this, component);
+}
+
+}  // namespace tools
+}  // namespace votca
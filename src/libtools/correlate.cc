@@ -17,6 +17,7 @@
 // Local VOTCA includes
 #include "votca/tools/correlate.h"
 #include "votca/tools/eigen.h"
+#include "votca/tools/threadpool.h"
 
 namespace votca {
 namespace tools {
@@ -29,7 +30,8 @@ void Correlate::CalcCorrelations(DataCollection<double>::selection &data) {
   xm /= Nd;
   double xsq = m0.abs2().sum();
 
-  for (Index v = 1; v < data.size(); v++) {
+  std::vector<double> corr(data.size() - 1);
+  ThreadPool::Global().parallel_for(1, data.size(), [&](Index v) {
     Eigen::Map<Eigen::ArrayXd> m_v(data[v].data(), N);
     double ym = m_v.sum();
     double ysq = m_v.abs2().sum();
@@ -37,8 +39,9 @@ void Correlate::CalcCorrelations(DataCollection<double>::selection &data) {
     ym /= Nd;
     double norm = std::sqrt((xsq - Nd * xm * xm) * (ysq - Nd * ym * ym));
     p = (p - Nd * xm * ym) / norm;
-    _corr.push_back(p);
-  }
+    corr[v - 1] = p;
+  });
+  _corr.insert(_corr.end(), corr.begin(), corr.end());
 }
 
 }  // namespace tools
@@ -22,6 +22,7 @@
 // Local VOTCA includes
 #include "votca/tools/cubicspline.h"
 #include "votca/tools/linalg.h"
+#include "votca/tools/profiler.h"
 
 namespace votca {
 namespace tools {
@@ -84,6 +85,7 @@ void CubicSpline::Interpolate(const Eigen::VectorXd &x,
 }
 
 void CubicSpline::Fit(const Eigen::VectorXd &x, const Eigen::VectorXd &y) {
+  VOTCA_PROFILE_REGION("CubicSpline::Fit");
   if (x.size() != y.size()) {
     throw std::invalid_argument(
         "error in CubicSpline::Fit : sizes of vectors x and y do not match");
@@ -0,0 +1,343 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Local VOTCA includes
+#include "votca/tools/cyclebasis.h"
+#include "votca/tools/edge.h"
+#include "votca/tools/graph.h"
+
+namespace votca {
+namespace tools {
+
+using namespace std;
+
+namespace {
+
+/**
+ * Adjacency in compressed rows, vertices are numbered by their position in
+ * the sorted vertex list
+ **/
+struct CompactAdjacency {
+  vector<Index> vertices;
+  vector<Index> offsets;
+  vector<Index> adjacency;
+
+  explicit CompactAdjacency(const Graph& graph)
+      : vertices(graph.getVertices()) {
+    sort(vertices.begin(), vertices.end());
+    unordered_map<Index, Index> index;
+    index.reserve(vertices.size());
+    for (Index i = 0; i < Index(vertices.size()); ++i) {
+      index[vertices[i]] = i;
+    }
+    offsets.push_back(0);
+    for (Index vertex : vertices) {
+      Index start = Index(adjacency.size());
+      for (Index neighbor : graph.getNeighVertices(vertex)) {
+        if (neighbor != vertex) {
+          adjacency.push_back(index.at(neighbor));
+        }
+      }
+      sort(adjacency.begin() + start, adjacency.end());
+      adjacency.erase(unique(adjacency.begin() + start, adjacency.end()),
+                      adjacency.end());
+      offsets.push_back(Index(adjacency.size()));
+    }
+  }
+};
+
+/// Set of ring edges as bits for the elimination over GF(2)
+class EdgeBits {
+ public:
+  explicit EdgeBits(Index nedges) : words_((nedges + 63) / 64, 0) {}
+  void flip(Index edge) {
+    words_[edge / 64] ^= std::uint64_t(1) << (edge % 64);
+  }
+  bool test(Index edge) const {
+    return (words_[edge / 64] >> (edge % 64)) & std::uint64_t(1);
+  }
+  void add(const EdgeBits& other) {
+    for (size_t i = 0; i < words_.size(); ++i) {
+      words_[i] ^= other.words_[i];
+    }
+  }
+  /// lowest edge in the set, -1 if it is empty
+  Index lowest() const {
+    for (size_t i = 0; i < words_.size(); ++i) {
+      if (words_[i]) {
+        Index bit = 0;
+        while (((words_[i] >> bit) & std::uint64_t(1)) == 0) {
+          ++bit;
+        }
+        return Index(i) * 64 + bit;
+      }
+    }
+    return -1;
+  }
+
+ private:
+  vector<std::uint64_t> words_;
+};
+
+/**
+ * Breadth first search trees of a ring system, reused for every root. Only
+ * the vertices visited from the last root are reset.
+ **/
+class ShortestPathTree {
+ public:
+  explicit ShortestPathTree(Index nvertices)
+      : parent_(nvertices, -1),
+        distance_(nvertices, -1),
+        branch_(nvertices, -1) {}
+
+  /**
+   * Searches from root only as deep as rings of max_length reach and
+   * appends every candidate with a length in [min_length, max_length], i.e.
+   * the ring closed by a non tree edge whose paths to the root only share
+   * the root. The vertices are visited in the same order as by a complete
+   * search, so the candidates are the same.
+   **/
+  void addCandidates(const CompactAdjacency& graph, const vector<bool>& in_core,
+                     Index root, Index root_position, Index min_length,
+                     Index max_length,
+                     vector<pair<array<Index, 4>, vector<Index>>>& candidates) {
+    for (Index vertex : visited_) {
+      parent_[vertex] = -1;
+      distance_[vertex] = -1;
+      branch_[vertex] = -1;
+    }
+    visited_.assign(1, root);
+    distance_[root] = 0;
+    branch_[root] = root;
+    Index max_distance = max_length / 2;
+    for (size_t front = 0; front < visited_.size(); ++front) {
+      Index vertex = visited_[front];
+      if (distance_[vertex] > max_distance) {
+        break;
+      }
+      for (Index k = graph.offsets[vertex]; k < graph.offsets[vertex + 1];
+           ++k) {
+        Index neighbor = graph.adjacency[k];
+        if (!in_core[neighbor]) {
+          continue;
+        }
+        if (distance_[neighbor] < 0) {
+          distance_[neighbor] = distance_[vertex] + 1;
+          parent_[neighbor] = vertex;
+          branch_[neighbor] = (vertex == root) ? neighbor : branch_[vertex];
+          visited_.push_back(neighbor);
+        } else if (vertex < neighbor && parent_[neighbor] != vertex &&
+                   parent_[vertex] != neighbor &&
+                   branch_[vertex] != branch_[neighbor]) {
+          Index length = distance_[vertex] + distance_[neighbor] + 1;
+          if (length >= min_length && length <= max_length) {
+            candidates.emplace_back(
+                array<Index, 4>{{length, root_position, vertex, neighbor}},
+                ring_(root, vertex, neighbor));
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  /// root ... end1 followed by end2 ... back to the root
+  vector<Index> ring_(Index root, Index end1, Index end2) const {
+    vector<Index> ring;
+    for (Index vertex = end1; vertex >= 0; vertex = parent_[vertex]) {
+      ring.push_back(vertex);
+    }
+    reverse(ring.begin(), ring.end());
+    for (Index vertex = end2; vertex != root; vertex = parent_[vertex]) {
+      ring.push_back(vertex);
+    }
+    return ring;
+  }
+
+  vector<Index> parent_;
+  vector<Index> distance_;
+  // first vertex after the root on the path to each vertex
+  vector<Index> branch_;
+  vector<Index> visited_;
+};
+
+/**
+ * Starts the ring at its smallest vertex and walks towards the smaller of
+ * the two neighbors
+ **/
+vector<Index> canonicalRing(vector<Index> ring) {
+  auto smallest = min_element(ring.begin(), ring.end());
+  rotate(ring.begin(), smallest, ring.end());
+  if (ring.size() > 2 && ring.back() < ring[1]) {
+    reverse(ring.begin() + 1, ring.end());
+  }
+  return ring;
+}
+
+void addRingSystemBasis(const CompactAdjacency& graph,
+                        const vector<Index>& system,
+                        const vector<bool>& in_core,
+                        const vector<Index>& core_degree,
+                        vector<vector<Index>>& rings) {
+  // number the ring bonds of the system
+  unordered_map<Edge, Index> edge_index;
+  for (Index vertex : system) {
+    for (Index k = graph.offsets[vertex]; k < graph.offsets[vertex + 1]; ++k) {
+      Index neighbor = graph.adjacency[k];
+      if (in_core[neighbor] && vertex < neighbor) {
+        edge_index.emplace(Edge(vertex, neighbor), Index(edge_index.size()));
+      }
+    }
+  }
+  Index nedges = Index(edge_index.size());
+  Index rank = nedges - Index(system.size()) + 1;
+  if (rank <= 0) {
+    return;
+  }
+
+  vector<Index> roots;
+  for (Index vertex : system) {
+    if (core_degree[vertex] > 2) {
+      roots.push_back(vertex);
+    }
+  }
+  // a ring system without junctions is a single ring
+  if (roots.empty()) {
+    roots.push_back(system.front());
+  }
+
+  // Storing the search trees of all roots, or all their candidates, takes
+  // memory quadratic in the size of large ring systems. Instead the
+  // candidates are collected in windows of doubling length, searching only
+  // as deep as the window needs. Sorted by length, root position and ends
+  // they come in the same order as if they were all collected at once.
+  ShortestPathTree tree(Index(graph.vertices.size()));
+  vector<EdgeBits> basis;
+  vector<Index> pivots;
+  for (Index min_length = 3; min_length <= Index(system.size());
+       min_length = 2 * min_length + 1) {
+    Index max_length = 2 * min_length;
+    vector<pair<array<Index, 4>, vector<Index>>> candidates;
+    for (Index r = 0; r < Index(roots.size()); ++r) {
+      tree.addCandidates(graph, in_core, roots[r], r, min_length, max_length,
+                         candidates);
+    }
+    sort(candidates.begin(), candidates.end(),
+         [](const pair<array<Index, 4>, vector<Index>>& a,
+            const pair<array<Index, 4>, vector<Index>>& b) {
+           return a.first < b.first;
+         });
+
+    for (auto& candidate : candidates) {
+      vector<Index>& ring = candidate.second;
+      EdgeBits reduced(nedges);
+      for (size_t i = 0; i < ring.size(); ++i) {
+        reduced.flip(edge_index.at(Edge(ring[i], ring[(i + 1) % ring.size()])));
+      }
+      for (size_t i = 0; i < basis.size(); ++i) {
+        if (reduced.test(pivots[i])) {
+          reduced.add(basis[i]);
+        }
+      }
+      Index pivot = reduced.lowest();
+      if (pivot < 0) {
+        continue;
+      }
+      basis.push_back(reduced);
+      pivots.push_back(pivot);
+      for (Index& vertex : ring) {
+        vertex = graph.vertices[vertex];
+      }
+      rings.push_back(canonicalRing(ring));
+      if (Index(basis.size()) == rank) {
+        return;
+      }
+    }
+  }
+}
+}  // namespace
+
+vector<vector<Index>> findMinimumCycleBasis(const Graph& graph) {
+  CompactAdjacency adjacency(graph);
+  Index nvertices = Index(adjacency.vertices.size());
+
+  // prune everything that is not part of a ring, what remains is the 2-core
+  vector<Index> core_degree(nvertices);
+  vector<bool> in_core(nvertices, true);
+  vector<Index> leaves;
+  for (Index vertex = 0; vertex < nvertices; ++vertex) {
+    core_degree[vertex] =
+        adjacency.offsets[vertex + 1] - adjacency.offsets[vertex];
+    if (core_degree[vertex] < 2) {
+      leaves.push_back(vertex);
+      in_core[vertex] = false;
+    }
+  }
+  while (!leaves.empty()) {
+    Index vertex = leaves.back();
+    leaves.pop_back();
+    for (Index k = adjacency.offsets[vertex]; k < adjacency.offsets[vertex + 1];
+         ++k) {
+      Index neighbor = adjacency.adjacency[k];
+      if (in_core[neighbor] && --core_degree[neighbor] < 2) {
+        in_core[neighbor] = false;
+        leaves.push_back(neighbor);
+      }
+    }
+  }
+
+  // every connected part of the core is a ring system
+  vector<vector<Index>> rings;
+  vector<bool> assigned(nvertices, false);
+  for (Index start = 0; start < nvertices; ++start) {
+    if (!in_core[start] || assigned[start]) {
+      continue;
+    }
+    vector<Index> system{start};
+    assigned[start] = true;
+    for (size_t front = 0; front < system.size(); ++front) {
+      Index vertex = system[front];
+      for (Index k = adjacency.offsets[vertex];
+           k < adjacency.offsets[vertex + 1]; ++k) {
+        Index neighbor = adjacency.adjacency[k];
+        if (in_core[neighbor] && !assigned[neighbor]) {
+          assigned[neighbor] = true;
+          system.push_back(neighbor);
+        }
+      }
+    }
+    sort(system.begin(), system.end());
+    addRingSystemBasis(adjacency, system, in_core, core_degree, rings);
+  }
+
+  sort(rings.begin(), rings.end(),
+       [](const vector<Index>& a, const vector<Index>& b) {
+         return a.size() < b.size() || (a.size() == b.size() && a < b);
+       });
+  return rings;
+}
+
+}  // namespace tools
+}  // namespace votca
@@ -18,9 +18,8 @@
  */
 
 // Standard includes
-#include <algorithm>
 #include <iostream>
-#include <vector>
+#include <type_traits>
 
 // Local VOTCA includes
 #include "votca/tools/edge.h"
@@ -30,60 +29,14 @@ namespace tools {
 
 using namespace std;
 
-Edge::Edge(Index ID1, Index ID2) {
-  vertices_ = vector<Index>{min({ID1, ID2}), max({ID1, ID2})};
-}
-
-Index Edge::getOtherEndPoint(Index ver) const {
-  if (ver == vertices_.front()) {
-    return vertices_.back();
-  } else {
-    return vertices_.front();
-  }
-}
-
-bool Edge::contains(Index ID) const {
-  return (vertices_.front() == ID || vertices_.back() == ID);
-}
-
-bool Edge::operator==(const Edge& ed) const {
-  if (this->vertices_.front() == ed.vertices_.front() &&
-      this->vertices_.back() == ed.vertices_.back()) {
-    return true;
-  }
-  if (this->vertices_.back() == ed.vertices_.front() &&
-      this->vertices_.front() == ed.vertices_.back()) {
-    return true;
-  }
-  return false;
-}
-
-bool Edge::operator!=(const Edge& ed) const { return !(*this == ed); }
-
-bool Edge::operator<(const Edge& ed) const {
-  if (this->vertices_.front() < ed.vertices_.front()) {
-    return true;
-  }
-  if (this->vertices_.front() > ed.vertices_.front()) {
-    return false;
-  }
-  if (this->vertices_.back() < ed.vertices_.back()) {
-    return true;
-  }
-  return false;
-}
-
-bool Edge::operator<=(const Edge& ed) const {
-  return (*this < ed || *this == ed);
-}
-
-bool Edge::operator>(const Edge& ed) const { return !(*this <= ed); }
-
-bool Edge::operator>=(const Edge& ed) const { return !(*this < ed); }
+static_assert(is_trivially_copyable<Edge>::value,
+              "Edge is expected to be trivially copyable");
+static_assert(sizeof(Edge) == 2 * sizeof(Index),
+              "Edge is expected to store only its two end points");
 
 ostream& operator<<(ostream& os, const Edge& ed) {
   os << "Vertices" << endl;
-  os << ed.vertices_.front() << " " << ed.vertices_.back() << endl;
+  os << ed.vertex1_ << " " << ed.vertex2_ << endl;
   return os;
 }
 }  // namespace tools
@@ -159,16 +159,20 @@ vector<Index> EdgeContainer::getNeighVertices(Index vertex) const {
 
 vector<Edge> EdgeContainer::getNeighEdges(Index vertex) const {
   vector<Edge> neigh_edges;
-  if (adj_list_.count(vertex)) {
-    for (const pair<const Index, Index>& neigh_and_count :
-         adj_list_.at(vertex)) {
-      for (Index count = 0;
-           count < adj_list_.at(vertex).at(neigh_and_count.first); ++count) {
-        neigh_edges.push_back(Edge(vertex, neigh_and_count.first));
+  getNeighEdges(vertex, neigh_edges);
+  return neigh_edges;
+}
+
+void EdgeContainer::getNeighEdges(Index vertex, vector<Edge>& edges) const {
+  edges.clear();
+  auto neighbors = adj_list_.find(vertex);
+  if (neighbors != adj_list_.end()) {
+    for (const pair<const Index, Index>& neigh_and_count : neighbors->second) {
+      for (Index count = 0; count < neigh_and_count.second; ++count) {
+        edges.push_back(Edge(vertex, neigh_and_count.first));
       }
     }
   }
-  return neigh_edges;
 }
 
 vector<Edge> EdgeContainer::getEdges() const {
@@ -17,8 +17,20 @@
  *
  */
 
+// Standard includes
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
 // Local VOTCA includes
 #include "votca/tools/eigen.h"
+#include "votca/tools/eigenio_matrixmarket.h"
+#include "votca/tools/threadpool.h"
 #include "votca/tools/tokenizer.h"
 #include "votca/tools/types.h"
 
@@ -27,6 +39,168 @@ namespace tools {
 
 namespace EigenIO_MatrixMarket {
 
+namespace {
+
+// each chunk should at least have this many bytes of text
+const std::size_t min_bytes_per_chunk = 1 << 22;
+
+// one chunk per thread of ThreadPool::Global()
+Index NumberOfChunks(std::size_t bytes) {
+  Index nchunks = Index(bytes / min_bytes_per_chunk);
+  Index nthreads = ThreadPool::Global().size();
+  return std::max(Index(1), std::min(nchunks, nthreads));
+}
+
+std::string ReadFile(const std::string& filename) {
+  std::ifstream in(filename, std::ios::in | std::ios::binary);
+  if (!in) {
+    throw std::runtime_error("Could not open " + filename);
+  }
+  in.seekg(0, std::ios::end);
+  std::string buffer(std::size_t(in.tellg()), '\0');
+  in.seekg(0, std::ios::beg);
+  in.read(&buffer[0], std::streamsize(buffer.size()));
+  return buffer;
+}
+
+struct Header {
+  std::string format;
+  std::string field;
+  std::string symmetry;
+  // position of the first character after the size line
+  std::size_t data_begin = 0;
+  std::vector<Index> sizes;
+};
+
+Header ReadHeader(const std::string& buffer, const std::string& filename) {
+  Header header;
+  std::size_t pos = buffer.find('\n');
+  std::string banner = buffer.substr(0, pos);
+  std::vector<std::string> words = Tokenizer(banner, " \t\r").ToVector();
+  if (words.size() != 5 || words[0] != "%%MatrixMarket" ||
+      words[1] != "matrix") {
+    throw std::runtime_error("Could not read " + filename);
+  }
+  header.format = words[2];
+  header.field = words[3];
+  header.symmetry = words[4];
+
+  // Skip comments and empty lines
+  std::string line;
+  while (pos != std::string::npos) {
+    std::size_t next = buffer.find('\n', pos + 1);
+    line = buffer.substr(pos + 1, next - pos - 1);
+    pos = next;
+    if (line.find_first_not_of(" \t\r") != std::string::npos &&
+        line[0] != '%') {
+      break;
+    }
+  }
+  header.data_begin = (pos == std::string::npos) ? buffer.size() : pos + 1;
+  std::istringstream sizeline(line);
+  Index size;
+  while (sizeline >> size) {
+    header.sizes.push_back(size);
+  }
+  return header;
+}
+
+// parses all numbers in [begin,end), comment lines are skipped
+void ParseChunk(const char* begin, const char* end,
+                std::vector<double>& values) {
+  const char* p = begin;
+  while (p < end) {
+    if (std::isspace(static_cast<unsigned char>(*p))) {
+      p++;
+    } else if (*p == '%') {
+      while (p < end && *p != '\n') {
+        p++;
+      }
+    } else {
+      char* next = nullptr;
+      values.push_back(std::strtod(p, &next));
+      if (next == p) {
+        throw std::runtime_error("Could not parse value '" +
+                                 std::string(p, std::find(p, end, '\n')) +
+                                 "' in MatrixMarket file");
+      }
+      p = next;
+    }
+  }
+}
+
+// splits the text in chunks at line boundaries, parses them in parallel and
+// returns all values in order
+std::vector<double> ParseValues(const std::string& buffer, std::size_t begin,
+                                std::size_t expected) {
+  std::size_t length = buffer.size() - begin;
+  Index nchunks = NumberOfChunks(length);
+  std::vector<std::size_t> bounds(nchunks + 1, buffer.size());
+  bounds[0] = begin;
+  for (Index i = 1; i < nchunks; i++) {
+    std::size_t bound = begin + std::size_t(i) * (length / nchunks);
+    bound = buffer.find('\n', std::max(bound, bounds[i - 1]));
+    bounds[i] = (bound == std::string::npos) ? buffer.size() : bound + 1;
+  }
+
+  std::vector<std::vector<double>> chunks(nchunks);
+  chunks[0].reserve(expected);
+  ThreadPool::Global().parallel_for(
+      0, nchunks,
+      [&](Index i) {
+        ParseChunk(buffer.data() + bounds[i], buffer.data() + bounds[i + 1],
+                   chunks[i]);
+      },
+      1);
+
+  std::vector<double>& values = chunks[0];
+  for (Index i = 1; i < nchunks; i++) {
+    values.insert(values.end(), chunks[i].begin(), chunks[i].end());
+  }
+  return std::move(values);
+}
+
+// calls format(i, text) for all i in [0,n) distributed over the threads of
+// ThreadPool::Global() and writes the concatenated text to ofs
+template <class Formatter>
+void WriteParallel(std::ofstream& ofs, Index n, std::size_t bytes,
+                   Formatter format) {
+  Index nchunks = std::min(std::max(n, Index(1)), NumberOfChunks(bytes));
+  std::vector<std::string> chunks(nchunks);
+  ThreadPool::Global().parallel_for(
+      0, nchunks,
+      [&](Index i) {
+        Index start = i * n / nchunks;
+        Index stop = (i + 1) * n / nchunks;
+        chunks[i].reserve(bytes / std::size_t(nchunks));
+        for (Index j = start; j < stop; j++) {
+          format(j, chunks[i]);
+        }
+      },
+      1);
+  for (const std::string& chunk : chunks) {
+    ofs.write(chunk.data(), std::streamsize(chunk.size()));
+  }
+}
+
+void AppendValue(double value, std::string& text) {
+  char buffer[32];
+  int length = std::snprintf(buffer, sizeof(buffer), "%.*g",
+                             std::numeric_limits<double>::max_digits10, value);
+  text.append(buffer, std::size_t(length));
+}
+
+std::ofstream OpenOutput(const std::string& filename) {
+  std::ofstream ofs;
+  ofs.open(filename, std::ofstream::out | std::ofstream::binary);
+  if (!ofs.is_open()) {
+    throw std::runtime_error("Could not create " + filename);
+  }
+  return ofs;
+}
+
+}  // namespace
+
 Eigen::VectorXd ReadVector(const std::string& filename) {
 
   Eigen::VectorXd output;
@@ -47,71 +221,115 @@ void WriteVector(const std::string& filename, const Eigen::VectorXd& output) {
 
 void WriteMatrix(const std::string& filename, const Eigen::MatrixXd& output) {
 
-  std::ofstream ofs;
-  ofs.open(filename, std::ofstream::out);
-  if (!ofs.is_open()) {
-    throw std::runtime_error("Could not create " + filename);
-  }
-
+  std::ofstream ofs = OpenOutput(filename);
   ofs << "%%MatrixMarket matrix array real general\n";
   ofs << output.rows() << " " << output.cols() << "\n";
-  const Eigen::Map<const Eigen::VectorXd> temp(output.data(), output.size());
-  ofs << temp;
+  const double* data = output.data();
+  WriteParallel(ofs, output.size(), std::size_t(output.size()) * 24,
+                [data](Index i, std::string& text) {
+                  AppendValue(data[i], text);
+                  text.push_back('\n');
+                });
   ofs.close();
 }
 
 Eigen::MatrixXd ReadMatrix(const std::string& filename) {
-  int sym = 0;
-  bool iscomplex = false;  // has to be false because getMarketHeader only sets
-                           // it to true but not to false
-  bool isvector = false;
-  bool success = Eigen::getMarketHeader(filename, sym, iscomplex, isvector);
-  if (!success) {
-    throw std::runtime_error("Could not read " + filename);
-  }
-  if (sym != 0) {
+  std::string buffer = ReadFile(filename);
+  Header header = ReadHeader(buffer, filename);
+  if (header.symmetry != "general") {
     throw std::runtime_error("Only supports reading in general matrices");
   }
-  if (iscomplex) {
+  if (header.field == "complex") {
     throw std::runtime_error(
         "Only supports reading in matrices with real numbers");
   }
+  if (header.format != "array") {
+    throw std::runtime_error("Use `ReadSparseMatrix` for sparse data");
+  }
+  if (header.sizes.size() != 2 || header.sizes[0] <= 0 ||
+      header.sizes[1] <= 0) {
+    throw std::runtime_error("Could not read matrix size from " + filename);
+  }
+  Index rows = header.sizes[0];
+  Index cols = header.sizes[1];
 
-  if (!isvector) {
+  std::vector<double> entries =
+      ParseValues(buffer, header.data_begin, std::size_t(rows * cols));
+  if (Index(entries.size()) != rows * cols) {
+    throw std::runtime_error("Matrix in " + filename +
+                             " has wrong number of entries");
+  }
+  return Eigen::Map<Eigen::MatrixXd>(entries.data(), rows, cols);
+}
+
+Eigen::SparseMatrix<double> ReadSparseMatrix(const std::string& filename) {
+  std::string buffer = ReadFile(filename);
+  Header header = ReadHeader(buffer, filename);
+  if (header.format != "coordinate") {
+    throw std::runtime_error("Use `ReadMatrix` for dense data");
+  }
+  if (header.field != "real" && header.field != "integer") {
     throw std::runtime_error(
-        "Use the eigen method `loadMarket` for  sparse data");
+        "Only supports reading in matrices with real numbers");
+  }
+  bool symmetric = (header.symmetry == "symmetric");
+  if (!symmetric && header.symmetry != "general") {
+    throw std::runtime_error(
+        "Only supports reading in general or symmetric matrices");
+  }
+  if (header.sizes.size() != 3) {
+    throw std::runtime_error("Could not read matrix size from " + filename);
   }
+  Index rows = header.sizes[0];
+  Index cols = header.sizes[1];
+  Index nonzeros = header.sizes[2];
 
-  std::ifstream in(filename, std::ios::in);
-  if (!in) {
-    throw std::runtime_error("Could not open " + filename);
+  std::vector<double> entries =
+      ParseValues(buffer, header.data_begin, std::size_t(3 * nonzeros));
+  if (Index(entries.size()) != 3 * nonzeros) {
+    throw std::runtime_error("Matrix in " + filename +
+                             " has wrong number of entries");
   }
 
-  std::string line;
-  Index cols = 0;
-  Index rows = 0;
-  do {  // Skip comments
-    std::getline(in, line);
-    assert(in.good());
-  } while (line[0] == '%');
-  std::istringstream newline(line);
-  newline >> rows >> cols;
-  assert(rows > 0 && cols > 0);
-
-  Index i = 0;
-  Index n = rows * cols;
-  std::vector<double> entries;
-  entries.reserve(n);
-  double value;
-  while (std::getline(in, line) && (i < n)) {
-    std::istringstream newline2(line);
-    newline2 >> value;
-    entries.push_back(value);
-    i++;
-  }
-  in.close();
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(std::size_t(symmetric ? 2 * nonzeros : nonzeros));
+  for (Index k = 0; k < nonzeros; k++) {
+    // MatrixMarket indices start at 1
+    Index i = Index(entries[3 * k]) - 1;
+    Index j = Index(entries[3 * k + 1]) - 1;
+    if (i < 0 || i >= rows || j < 0 || j >= cols) {
+      throw std::runtime_error("Index out of range in " + filename);
+    }
+    triplets.emplace_back(i, j, entries[3 * k + 2]);
+    if (symmetric && i != j) {
+      triplets.emplace_back(j, i, entries[3 * k + 2]);
+    }
+  }
+  Eigen::SparseMatrix<double> output(rows, cols);
+  output.setFromTriplets(triplets.begin(), triplets.end());
+  return output;
+}
 
-  return Eigen::Map<Eigen::MatrixXd>(entries.data(), rows, cols);
+void WriteSparseMatrix(const std::string& filename,
+                       const Eigen::SparseMatrix<double>& output) {
+  std::ofstream ofs = OpenOutput(filename);
+  ofs << "%%MatrixMarket matrix coordinate real general\n";
+  ofs << output.rows() << " " << output.cols() << " " << output.nonZeros()
+      << "\n";
+  WriteParallel(ofs, output.outerSize(), std::size_t(output.nonZeros()) * 40,
+                [&output](Index col, std::string& text) {
+                  for (Eigen::SparseMatrix<double>::InnerIterator it(output,
+                                                                     col);
+                       it; ++it) {
+                    text.append(std::to_string(it.row() + 1));
+                    text.push_back(' ');
+                    text.append(std::to_string(it.col() + 1));
+                    text.push_back(' ');
+                    AppendValue(it.value(), text);
+                    text.push_back('\n');
+                  }
+                });
+  ofs.close();
 }
 
 }  // namespace EigenIO_MatrixMarket
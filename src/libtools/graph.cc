@@ -20,9 +20,11 @@
 // Standard includes
 #include <algorithm>
 #include <cassert>
+#include <mutex>
 #include <string>
 
 // Local VOTCA includes
+#include "votca/tools/cyclebasis.h"
 #include "votca/tools/graph.h"
 
 using namespace std;
@@ -53,11 +55,40 @@ Graph::Graph(vector<Edge> edges, unordered_map<Index, GraphNode> nodes) {
       edge_container_.addVertex(id_and_node.first);
     }
   }
-  calcId_();
+  invalidateId_();
+}
+
+Graph::Graph(const Graph& graph) { *this = graph; }
+
+Graph::Graph(Graph&& graph) noexcept { *this = std::move(graph); }
+
+Graph& Graph::operator=(const Graph& graph) {
+  if (this == &graph) {
+    return *this;
+  }
+  // the source may be calculating its id or rings in another thread
+  lock_guard<mutex> lock(graph.lazy_mutex_);
+  edge_container_ = graph.edge_container_;
+  nodes_ = graph.nodes_;
+  id_ = graph.id_;
+  id_outdated_ = graph.id_outdated_.load();
+  rings_ = graph.rings_;
+  rings_outdated_ = graph.rings_outdated_.load();
+  return *this;
+}
+
+Graph& Graph::operator=(Graph&& graph) noexcept {
+  edge_container_ = std::move(graph.edge_container_);
+  nodes_ = std::move(graph.nodes_);
+  id_ = std::move(graph.id_);
+  id_outdated_ = graph.id_outdated_.load();
+  rings_ = std::move(graph.rings_);
+  rings_outdated_ = graph.rings_outdated_.load();
+  return *this;
 }
 
 bool Graph::operator!=(const Graph& graph) const {
-  return id_.compare(graph.id_);
+  return getId().compare(graph.getId());
 }
 
 bool Graph::operator==(const Graph& graph) const { return !(*(this) != graph); }
@@ -84,16 +115,25 @@ vector<pair<Index, GraphNode>> Graph::getNeighNodes(Index vertex) const {
   return neigh_ids_and_nodes;
 }
 
-void Graph::setNode(Index vertex, GraphNode& graph_node) {
+void Graph::setNode(Index vertex, const GraphNode& graph_node) {
   assert(nodes_.count(vertex) && "Can only set a node that already exists");
   nodes_[vertex] = graph_node;
-  calcId_();
+  invalidateId_();
 }
 
-void Graph::setNode(std::pair<Index, GraphNode>& id_and_node) {
+void Graph::setNode(const std::pair<Index, GraphNode>& id_and_node) {
   setNode(id_and_node.first, id_and_node.second);
 }
 
+void Graph::setNodes(const vector<pair<Index, GraphNode>>& ids_and_nodes) {
+  for (const pair<Index, GraphNode>& id_and_node : ids_and_nodes) {
+    assert(nodes_.count(id_and_node.first) &&
+           "Can only set a node that already exists");
+    nodes_[id_and_node.first] = id_and_node.second;
+  }
+  invalidateId_();
+}
+
 GraphNode Graph::getNode(const Index vertex) const {
   assert(nodes_.count(vertex));
   return nodes_.at(vertex);
@@ -117,24 +157,41 @@ vector<Index> Graph::getJunctions() const {
   return junctions;
 }
 
-void Graph::clearNodes() { nodes_.clear(); }
+void Graph::clearNodes() {
+  nodes_.clear();
+  invalidateId_();
+}
 
 void Graph::copyNodes(Graph& graph) {
   assert(nodes_.size() == 0);
   for (const pair<const Index, GraphNode>& id_and_node : graph.nodes_) {
     this->nodes_[id_and_node.first] = id_and_node.second;
   }
+  invalidateId_();
 }
 
-void Graph::calcId_() {
-  auto nodes = getNodes();
-  sort(nodes.begin(), nodes.end(), cmpVertNodePair);
-  string struct_Id_temp = "";
+void Graph::calcId_() const {
+  lock_guard<mutex> lock(lazy_mutex_);
+  if (!id_outdated_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  // the id is the concatenation of the sorted node ids, same order as
+  // cmpVertNodePair
+  vector<pair<Index, GraphNode>> nodes = getNodes();
+  vector<string> node_ids;
+  node_ids.reserve(nodes.size());
+  size_t length = 0;
   for (const pair<Index, GraphNode>& id_and_node : nodes) {
-    struct_Id_temp.append(id_and_node.second.getStringId());
+    node_ids.push_back(id_and_node.second.getStringId());
+    length += node_ids.back().size();
+  }
+  sort(node_ids.begin(), node_ids.end());
+  id_.clear();
+  id_.reserve(length);
+  for (const string& node_id : node_ids) {
+    id_.append(node_id);
   }
-  id_ = struct_Id_temp;
-  return;
+  id_outdated_.store(false, std::memory_order_release);
 }
 
 Index Graph::getDegree(Index vertex) const {
@@ -167,6 +224,21 @@ vector<Index> Graph::getVertices() const {
   return edge_container_.getVertices();
 }
 
+const vector<vector<Index>>& Graph::getRings() const {
+  if (rings_outdated_.load(std::memory_order_acquire)) {
+    lock_guard<mutex> lock(lazy_mutex_);
+    if (rings_outdated_.load(std::memory_order_relaxed)) {
+      rings_ = calcRings_();
+      rings_outdated_.store(false, std::memory_order_release);
+    }
+  }
+  return rings_;
+}
+
+vector<vector<Index>> Graph::calcRings_() const {
+  return findMinimumCycleBasis(*this);
+}
+
 ostream& operator<<(ostream& os, const Graph graph) {
   os << "Graph" << endl;
   for (const pair<const Index, GraphNode>& id_and_node : graph.nodes_) {
@@ -28,54 +28,31 @@ using namespace std;
 namespace votca {
 namespace tools {
 
-bool Graph_BF_Visitor::queEmpty() const { return edge_que_.empty(); }
+bool Graph_BF_Visitor::queEmpty() const {
+  return queue_front_ == edge_queue_.size();
+}
 
 Edge Graph_BF_Visitor::getEdge_() {
-  Edge oldest_edge = edge_que_.at(0).front();
-  edge_que_.at(0).pop();
-  if (edge_que_.at(0).size() == 0) {
-    edge_que_.pop_front();
+  Edge oldest_edge = edge_queue_[queue_front_++];
+  if (queue_front_ == edge_queue_.size()) {
+    clearEdges_();
   }
   return oldest_edge;
 }
 
-// Add edges to be explored
-void Graph_BF_Visitor::addEdges_(const Graph &graph, Index vertex) {
-
-  vector<Edge> newest_edges = graph.getNeighEdges(vertex);
-
-  // If first edges to be added
-  if (edge_que_.empty()) {
-    queue<Edge> first_edge_queue;
-    for (const Edge &edge : newest_edges) {
-      Index neigh_vert = edge.getOtherEndPoint(vertex);
-      if (explored_.count(neigh_vert) == 0) {
-        first_edge_queue.push(edge);
-      }
-    }
-    if (!first_edge_queue.empty()) {
-      edge_que_.push_back(first_edge_queue);
-    }
-  } else {
+void Graph_BF_Visitor::clearEdges_() {
+  edge_queue_.clear();
+  queue_front_ = 0;
+}
 
-    if (edge_que_.size() == 1) {
-      queue<Edge> new_edge_queue;
-      for (const Edge &edge : newest_edges) {
-        Index neigh_vert = edge.getOtherEndPoint(vertex);
-        if (explored_.count(neigh_vert) == 0) {
-          new_edge_queue.push(edge);
-        }
-      }
-      if (!new_edge_queue.empty()) {
-        edge_que_.push_back(new_edge_queue);
-      }
-    } else {
-      for (const Edge &edge : newest_edges) {
-        Index neigh_vert = edge.getOtherEndPoint(vertex);
-        if (explored_.count(neigh_vert) == 0) {
-          edge_que_.at(1).push(edge);
-        }
-      }
+// Add edges to be explored, edges are taken in the order they were added so
+// the vertices closest to the starting vertex are explored first
+void Graph_BF_Visitor::addEdges_(const Graph &graph, Index vertex) {
+  graph.getNeighEdges(vertex, neigh_edges_);
+  for (const Edge &edge : neigh_edges_) {
+    Index neigh_vert = edge.getOtherEndPoint(vertex);
+    if (explored_.count(neigh_vert) == 0) {
+      edge_queue_.push_back(edge);
     }
   }
 }
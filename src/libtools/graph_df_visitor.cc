@@ -17,9 +17,6 @@
  *
  */
 
-// Standard includes
-#include <algorithm>
-
 // Local VOTCA includes
 #include "votca/tools/edge.h"
 #include "votca/tools/graph.h"
@@ -31,38 +28,55 @@ using namespace std;
 namespace votca {
 namespace tools {
 
-bool Graph_DF_Visitor::queEmpty() const { return edge_list_.empty(); }
+bool Graph_DF_Visitor::queEmpty() const { return waiting_edges_ == 0; }
 
 Edge Graph_DF_Visitor::getEdge_() {
-  Edge ed = edge_list_.back();
-  edge_list_.pop_back();
+  while (!entries_[edge_stack_.back()].waiting) {
+    edge_stack_.pop_back();
+  }
+  StackEntry& entry = entries_[edge_stack_.back()];
+  edge_stack_.pop_back();
+  entry.waiting = false;
+  Edge ed = entry.edge;
+  if (--waiting_edges_ == 0) {
+    // nothing refers to the old entries anymore
+    clearEdges_();
+  }
   return ed;
 }
 
+void Graph_DF_Visitor::clearEdges_() {
+  entries_.clear();
+  edge_stack_.clear();
+  waiting_edges_ = 0;
+  last_to_vertex_.clear();
+}
+
 // Add edges to be explored
 void Graph_DF_Visitor::addEdges_(const Graph& g, Index vertex) {
-  auto eds = g.getNeighEdges(vertex);
-  if (edge_list_.empty()) {
-    // If first edges to be added
-    for (auto ed : eds) {
-      Index neigh_vert = ed.getOtherEndPoint(vertex);
-      if (explored_.count(neigh_vert) == 0) {
-        edge_list_.push_back(ed);
-      }
-    }
-  } else {
-    for (const auto& ed : eds) {
-      Index neigh_vert = ed.getOtherEndPoint(vertex);
-      if (explored_.count(neigh_vert) == 0) {
-        edge_list_.push_back(ed);
-      } else {
-        // Check if edge has already been added earlier in the queue
-        // if so we wil move it to the end
-        list<Edge>::iterator edge_found_iterator =
-            find(edge_list_.begin(), edge_list_.end(), ed);
-        if (edge_found_iterator != edge_list_.end()) {
-          // Move the edge to the back if it was stored earlier on.
-          edge_list_.splice(edge_list_.end(), edge_list_, edge_found_iterator);
+  g.getNeighEdges(vertex, neigh_edges_);
+  for (const Edge& ed : neigh_edges_) {
+    Index neigh_vert = ed.getOtherEndPoint(vertex);
+    if (explored_.count(neigh_vert) == 0) {
+      const Index* last = last_to_vertex_.find(neigh_vert);
+      Index id = Index(entries_.size());
+      entries_.push_back(StackEntry{ed, last ? *last : -1, true});
+      edge_stack_.push_back(id);
+      last_to_vertex_.set(neigh_vert, id);
+      ++waiting_edges_;
+    } else {
+      // Check if edge has already been added earlier in the stack, if so it
+      // is moved to the top. It can only have been added while exploring
+      // neigh_vert, so it leads to this vertex
+      const Index* last = last_to_vertex_.find(vertex);
+      for (Index id = last ? *last : -1; id >= 0;
+           id = entries_[id].next_to_vertex) {
+        if (entries_[id].waiting && entries_[id].edge == ed) {
+          entries_[id].waiting = false;
+          Index moved_id = Index(entries_.size());
+          entries_.push_back(StackEntry{ed, -1, true});
+          edge_stack_.push_back(moved_id);
+          break;
         }
       }
     }
@@ -21,11 +21,13 @@
 #include <list>
 
 // Local VOTCA includes
+#include "votca/tools/connectedcomponents.h"
 #include "votca/tools/graph.h"
 #include "votca/tools/graph_bf_visitor.h"
 #include "votca/tools/graph_df_visitor.h"
 #include "votca/tools/graphalgorithm.h"
 #include "votca/tools/graphvisitor.h"
+#include "votca/tools/profiler.h"
 
 using namespace std;
 
@@ -41,8 +43,8 @@ namespace tools {
  ********************/
 bool singleNetwork(Graph& graph, GraphVisitor& graph_visitor) {
   exploreGraph(graph, graph_visitor);
-  return graph_visitor.getExploredVertices().size() ==
-             graph.getVertices().size() &&
+  return graph_visitor.getExploredCount() ==
+             Index(graph.getVertices().size()) &&
          graph.getIsolatedNodes().size() == 0;
 }
 
@@ -98,6 +100,7 @@ std::set<Edge> exploreBranch(Graph g, Index starting_vertex, const Edge& edge) {
 }
 
 ReducedGraph reduceGraph(Graph graph) {
+  VOTCA_PROFILE_REGION("reduceGraph");
 
   /****************************
    * Internal Function Class
@@ -228,9 +231,9 @@ ReducedGraph reduceGraph(Graph graph) {
     }
   }
   vector<ReducedEdge> reduced_edges;
-  for (vector<Index> chain : chains) {
-    ReducedEdge reduced_edge(chain);
-    reduced_edges.push_back(reduced_edge);
+  reduced_edges.reserve(chains.size());
+  for (const vector<Index>& chain : chains) {
+    reduced_edges.emplace_back(chain);
   }
 
   ReducedGraph reduced_g(reduced_edges);
@@ -241,55 +244,18 @@ ReducedGraph reduceGraph(Graph graph) {
   return reduced_g;
 }
 
-vector<Graph> decoupleIsolatedSubGraphs(Graph graph) {
-
-  const std::vector<Index>& vertices = graph.getVertices();
-  // bool vector to see if vertex is already part of graph
-  std::vector<bool> vertex_analysed = std::vector<bool>(vertices.size(), false);
-
-  std::vector<Graph> subGraphs;
-  Index i = 0;
-  while (i < Index(vertices.size())) {
-    if (vertex_analysed[i]) {
-      i++;
-      continue;
-    }
-    Graph_BF_Visitor graph_visitor_breadth_first;
-    graph_visitor_breadth_first.setStartingVertex(vertices[i]);
-    exploreGraph(graph, graph_visitor_breadth_first);
-    set<Index> sub_graph_explored_vertices =
-        graph_visitor_breadth_first.getExploredVertices();
-
-    for (Index vertex : sub_graph_explored_vertices) {
-      for (Index j = 0; j < Index(vertices.size()); j++) {
-        if (vertex_analysed[j]) {
-          continue;
-        }
-        if (vertex == vertices[j]) {
-          vertex_analysed[j] = true;
-          break;
-        }
-      }
-    }
-
-    set<Edge> sub_graph_edges;
-    unordered_map<Index, GraphNode> sub_graph_nodes;
-    for (Index vertex : sub_graph_explored_vertices) {
-
-      for (const Edge& sub_graph_edge : graph.getNeighEdges(vertex)) {
-        sub_graph_edges.insert(sub_graph_edge);
-      }
-      sub_graph_nodes[vertex] = graph.getNode(vertex);
-    }
-    subGraphs.push_back(
-        Graph(std::vector<Edge>(sub_graph_edges.begin(), sub_graph_edges.end()),
-              sub_graph_nodes));
+vector<Graph> decoupleIsolatedSubGraphs(const Graph& graph) {
+  ConnectedComponents components(graph);
+  vector<Graph> subGraphs;
+  subGraphs.reserve(components.size());
+  for (Index component = 0; component < components.size(); ++component) {
+    subGraphs.push_back(components.getSubGraph(component).toGraph(graph));
   }
   return subGraphs;
 }
 
 void exploreGraph(Graph& graph, GraphVisitor& graph_visitor) {
-
+  VOTCA_PROFILE_REGION("exploreGraph");
   if (!graph.vertexExist(graph_visitor.getStartingVertex())) {
     string err = "Cannot explore graph starting at vertex " +
                  to_string(graph_visitor.getStartingVertex()) +
@@ -305,6 +271,8 @@ void exploreGraph(Graph& graph, GraphVisitor& graph_visitor) {
     Edge edge = graph_visitor.nextEdge(graph);
     graph_visitor.exec(graph, edge);
   }
+  VOTCA_PROFILE_COUNT("exploreGraph vertices",
+                      graph_visitor.getExploredCount());
 }
 }  // namespace tools
 }  // namespace votca
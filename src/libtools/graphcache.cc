@@ -0,0 +1,499 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Local VOTCA includes
+#include "votca/tools/graphcache.h"
+#include "votca/tools/votca_tools_config.h"
+
+#ifdef HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace votca {
+namespace tools {
+
+using namespace std;
+
+namespace {
+
+const char file_magic[8] = {'V', 'O', 'T', 'C', 'A', 'G', 'R', 'C'};
+const std::uint32_t file_version = 3;
+
+template <class T>
+void writeValue(const T& value, vector<char>& buffer) {
+  static_assert(is_trivially_copyable<T>::value,
+                "only plain values can be written directly");
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void writeString(const string& value, vector<char>& buffer) {
+  writeValue(std::uint64_t(value.size()), buffer);
+  buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+void checkAvailable(const char* data, const char* end, std::uint64_t size) {
+  if (std::uint64_t(end - data) < size) {
+    throw runtime_error("GraphSerializer: unexpected end of graph data");
+  }
+}
+
+/// count values of type T have to fit into the remaining data, checked
+/// without multiplying, so a corrupt count cannot overflow
+template <class T>
+void checkCount(const char* data, const char* end, std::uint64_t count) {
+  if (count > std::uint64_t(end - data) / sizeof(T)) {
+    throw runtime_error("GraphSerializer: unexpected end of graph data");
+  }
+}
+
+template <class T>
+T readValue(const char*& data, const char* end) {
+  checkAvailable(data, end, sizeof(T));
+  T value;
+  memcpy(&value, data, sizeof(T));
+  data += sizeof(T);
+  return value;
+}
+
+string readString(const char*& data, const char* end) {
+  std::uint64_t size = readValue<std::uint64_t>(data, end);
+  checkAvailable(data, end, size);
+  string value(data, size);
+  data += size;
+  return value;
+}
+
+/// 64 bit FNV-1a
+class ContentHasher {
+ public:
+  void add(const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ULL;
+    }
+  }
+  std::uint64_t get() const { return hash_; }
+
+ private:
+  std::uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
+
+template <class T>
+vector<pair<string, T>> sortedAttributes(const unordered_map<string, T>& map) {
+  vector<pair<string, T>> sorted(map.begin(), map.end());
+  sort(sorted.begin(), sorted.end(),
+       [](const pair<string, T>& a, const pair<string, T>& b) {
+         return a.first < b.first;
+       });
+  return sorted;
+}
+
+/// Read only view of a whole file, memory mapped where possible
+class MappedFile {
+ public:
+  explicit MappedFile(const string& filename) {
+#ifdef HAVE_SYS_MMAN_H
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat status;
+    if (fstat(fd, &status) == 0 && status.st_size > 0) {
+      void* mapped =
+          mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped != MAP_FAILED) {
+        mapped_ = mapped;
+        size_ = size_t(status.st_size);
+        data_ = static_cast<const char*>(mapped);
+      }
+    }
+    close(fd);
+    if (mapped_ != nullptr) {
+      return;
+    }
+#endif
+    ifstream file(filename, ios::binary);
+    if (!file) {
+      return;
+    }
+    buffer_.assign(istreambuf_iterator<char>(file),
+                   istreambuf_iterator<char>());
+    size_ = buffer_.size();
+    data_ = buffer_.data();
+    exists_ = true;
+  }
+
+  ~MappedFile() {
+#ifdef HAVE_SYS_MMAN_H
+    if (mapped_ != nullptr) {
+      munmap(mapped_, size_);
+    }
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool exists() const { return exists_ || mapped_ != nullptr; }
+  const char* begin() const { return data_; }
+  const char* end() const { return data_ + size_; }
+
+ private:
+  void* mapped_ = nullptr;
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  bool exists_ = false;
+  vector<char> buffer_;
+};
+}  // namespace
+
+std::uint64_t GraphSerializer::ContentHash(
+    const vector<Edge>& edges, const unordered_map<Index, GraphNode>& nodes) {
+  vector<char> definition;
+  Write(edges, nodes, definition);
+  return ContentHash(definition);
+}
+
+std::uint64_t GraphSerializer::ContentHash(const vector<char>& definition) {
+  ContentHasher hasher;
+  hasher.add(definition.data(), definition.size());
+  return hasher.get();
+}
+
+void GraphSerializer::Write(const vector<Edge>& edges,
+                            const unordered_map<Index, GraphNode>& nodes,
+                            vector<char>& buffer) {
+  vector<Edge> sorted_edges = edges;
+  sort(sorted_edges.begin(), sorted_edges.end());
+  writeValue(std::uint64_t(sorted_edges.size()), buffer);
+  for (const Edge& edge : sorted_edges) {
+    writeValue(edge.getEndPoint1(), buffer);
+    writeValue(edge.getEndPoint2(), buffer);
+  }
+
+  vector<Index> vertices;
+  vertices.reserve(nodes.size());
+  for (const auto& vertex_and_node : nodes) {
+    vertices.push_back(vertex_and_node.first);
+  }
+  sort(vertices.begin(), vertices.end());
+  writeValue(std::uint64_t(vertices.size()), buffer);
+  for (Index vertex : vertices) {
+    const GraphNode& node = nodes.at(vertex);
+    writeValue(vertex, buffer);
+    auto int_vals = sortedAttributes(node.int_vals_);
+    writeValue(std::uint64_t(int_vals.size()), buffer);
+    for (const auto& name_and_value : int_vals) {
+      writeString(name_and_value.first, buffer);
+      writeValue(name_and_value.second, buffer);
+    }
+    auto double_vals = sortedAttributes(node.double_vals_);
+    writeValue(std::uint64_t(double_vals.size()), buffer);
+    for (const auto& name_and_value : double_vals) {
+      writeString(name_and_value.first, buffer);
+      writeValue(name_and_value.second, buffer);
+    }
+    auto str_vals = sortedAttributes(node.str_vals_);
+    writeValue(std::uint64_t(str_vals.size()), buffer);
+    for (const auto& name_and_value : str_vals) {
+      writeString(name_and_value.first, buffer);
+      writeString(name_and_value.second, buffer);
+    }
+  }
+}
+
+void GraphSerializer::writeNode_(const GraphNode& node, vector<char>& buffer) {
+  writeString(node.str_id_, buffer);
+  writeValue(std::uint64_t(node.int_vals_.size()), buffer);
+  for (const auto& name_and_value : node.int_vals_) {
+    writeString(name_and_value.first, buffer);
+    writeValue(name_and_value.second, buffer);
+  }
+  writeValue(std::uint64_t(node.double_vals_.size()), buffer);
+  for (const auto& name_and_value : node.double_vals_) {
+    writeString(name_and_value.first, buffer);
+    writeValue(name_and_value.second, buffer);
+  }
+  writeValue(std::uint64_t(node.str_vals_.size()), buffer);
+  for (const auto& name_and_value : node.str_vals_) {
+    writeString(name_and_value.first, buffer);
+    writeString(name_and_value.second, buffer);
+  }
+}
+
+void GraphSerializer::readNode_(const char*& data, const char* end,
+                                GraphNode& node) {
+  node.str_id_ = readString(data, end);
+  node.int_vals_.clear();
+  std::uint64_t count = readValue<std::uint64_t>(data, end);
+  for (std::uint64_t i = 0; i < count; ++i) {
+    string name = readString(data, end);
+    node.int_vals_[name] = readValue<Index>(data, end);
+  }
+  node.double_vals_.clear();
+  count = readValue<std::uint64_t>(data, end);
+  for (std::uint64_t i = 0; i < count; ++i) {
+    string name = readString(data, end);
+    node.double_vals_[name] = readValue<double>(data, end);
+  }
+  node.str_vals_.clear();
+  count = readValue<std::uint64_t>(data, end);
+  for (std::uint64_t i = 0; i < count; ++i) {
+    string name = readString(data, end);
+    node.str_vals_[name] = readString(data, end);
+  }
+}
+
+void GraphSerializer::writeGraph_(const Graph& graph, vector<char>& buffer) {
+  writeValue(std::uint64_t(graph.nodes_.size()), buffer);
+  for (const auto& vertex_and_node : graph.nodes_) {
+    writeValue(vertex_and_node.first, buffer);
+    writeNode_(vertex_and_node.second, buffer);
+  }
+  vector<Edge> edges = graph.edge_container_.getEdges();
+  writeValue(std::uint64_t(edges.size()), buffer);
+  for (const Edge& edge : edges) {
+    writeValue(edge, buffer);
+  }
+  writeString(graph.getId(), buffer);
+}
+
+void GraphSerializer::readGraph_(const char*& data, const char* end,
+                                 Graph& graph) {
+  graph.nodes_.clear();
+  std::uint64_t count = readValue<std::uint64_t>(data, end);
+  // every node starts with its vertex
+  checkCount<Index>(data, end, count);
+  graph.nodes_.reserve(count);
+  for (std::uint64_t i = 0; i < count; ++i) {
+    Index vertex = readValue<Index>(data, end);
+    readNode_(data, end, graph.nodes_[vertex]);
+  }
+  count = readValue<std::uint64_t>(data, end);
+  checkCount<Edge>(data, end, count);
+  vector<Edge> edges(count);
+  memcpy(edges.data(), data, count * sizeof(Edge));
+  data += count * sizeof(Edge);
+  graph.edge_container_ = EdgeContainer(edges);
+  for (const auto& vertex_and_node : graph.nodes_) {
+    if (!graph.edge_container_.vertexExist(vertex_and_node.first)) {
+      graph.edge_container_.addVertex(vertex_and_node.first);
+    }
+  }
+  graph.id_ = readString(data, end);
+  graph.id_outdated_ = false;
+  graph.rings_outdated_ = true;
+}
+
+void GraphSerializer::Write(const Graph& graph, vector<char>& buffer) {
+  writeGraph_(graph, buffer);
+}
+
+void GraphSerializer::Write(const ReducedGraph& graph, vector<char>& buffer) {
+  writeGraph_(graph, buffer);
+  writeValue(std::uint64_t(graph.chain_vertices_.size()), buffer);
+  for (Index vertex : graph.chain_vertices_) {
+    writeValue(vertex, buffer);
+  }
+  writeValue(std::uint64_t(graph.chain_offsets_.size()), buffer);
+  for (Index offset : graph.chain_offsets_) {
+    writeValue(offset, buffer);
+  }
+  writeValue(std::uint64_t(graph.edge_chains_.size()), buffer);
+  for (const auto& edge_and_chains : graph.edge_chains_) {
+    writeValue(edge_and_chains.first, buffer);
+    writeValue(std::uint64_t(edge_and_chains.second.size()), buffer);
+    for (Index chain : edge_and_chains.second) {
+      writeValue(chain, buffer);
+    }
+  }
+  writeValue(std::uint64_t(graph.junctions_.size()), buffer);
+  for (Index junction : graph.junctions_) {
+    writeValue(junction, buffer);
+  }
+}
+
+void GraphSerializer::Read(const char*& data, const char* end, Graph& graph) {
+  readGraph_(data, end, graph);
+}
+
+void GraphSerializer::Read(const char*& data, const char* end,
+                           ReducedGraph& graph) {
+  readGraph_(data, end, graph);
+  auto readIndices = [&](vector<Index>& indices) {
+    std::uint64_t count = readValue<std::uint64_t>(data, end);
+    checkCount<Index>(data, end, count);
+    indices.resize(count);
+    memcpy(indices.data(), data, count * sizeof(Index));
+    data += count * sizeof(Index);
+  };
+  readIndices(graph.chain_vertices_);
+  readIndices(graph.chain_offsets_);
+  graph.edge_chains_.clear();
+  std::uint64_t count = readValue<std::uint64_t>(data, end);
+  for (std::uint64_t i = 0; i < count; ++i) {
+    Edge edge = readValue<Edge>(data, end);
+    readIndices(graph.edge_chains_[edge]);
+  }
+  vector<Index> junctions;
+  readIndices(junctions);
+  graph.junctions_ = set<Index>(junctions.begin(), junctions.end());
+
+  // the chains are used as ranges of chain_vertices_, every chain holds at
+  // least one vertex
+  const vector<Index>& offsets = graph.chain_offsets_;
+  if (offsets.empty() || offsets.front() != 0 ||
+      offsets.back() != Index(graph.chain_vertices_.size()) ||
+      std::adjacent_find(offsets.begin(), offsets.end(),
+                         std::greater_equal<Index>()) != offsets.end()) {
+    throw runtime_error("GraphSerializer: invalid chain offsets");
+  }
+  Index nchains = Index(offsets.size()) - 1;
+  for (const auto& edge_and_chains : graph.edge_chains_) {
+    for (Index chain : edge_and_chains.second) {
+      if (chain < 0 || chain >= nchains) {
+        throw runtime_error("GraphSerializer: invalid chain id");
+      }
+    }
+  }
+}
+
+GraphCache::GraphCache(string directory) : directory_(std::move(directory)) {}
+
+string GraphCache::getFileName(std::uint64_t hash) const {
+  ostringstream name;
+  name << directory_ << "/" << hex << setw(16) << setfill('0') << hash
+       << ".graph";
+  return name.str();
+}
+
+vector<char> GraphCache::key_(const vector<Edge>& edges,
+                              const unordered_map<Index, GraphNode>& nodes,
+                              const string& visitor) {
+  vector<char> key;
+  writeString(visitor, key);
+  GraphSerializer::Write(edges, nodes, key);
+  return key;
+}
+
+std::uint64_t GraphCache::Hash(const vector<Edge>& edges,
+                               const unordered_map<Index, GraphNode>& nodes,
+                               const string& visitor) {
+  return GraphSerializer::ContentHash(key_(edges, nodes, visitor));
+}
+
+bool GraphCache::Load(const vector<Edge>& edges,
+                      const unordered_map<Index, GraphNode>& nodes,
+                      const string& visitor, Entry& entry) const {
+  return load_(key_(edges, nodes, visitor), entry);
+}
+
+bool GraphCache::load_(const vector<char>& key, Entry& entry) const {
+  std::uint64_t hash = GraphSerializer::ContentHash(key);
+  MappedFile file(getFileName(hash));
+  if (!file.exists()) {
+    return false;
+  }
+  const char* data = file.begin();
+  const char* end = file.end();
+  if (size_t(end - data) < sizeof(file_magic) ||
+      memcmp(data, file_magic, sizeof(file_magic)) != 0) {
+    return false;
+  }
+  data += sizeof(file_magic);
+  try {
+    // entries written by another version or for another definition or
+    // visitor with the same hash are rebuilt, as are truncated ones
+    if (readValue<std::uint32_t>(data, end) != file_version ||
+        readValue<std::uint64_t>(data, end) != hash ||
+        readValue<std::uint64_t>(data, end) != key.size()) {
+      return false;
+    }
+    checkAvailable(data, end, key.size());
+    if (memcmp(data, key.data(), key.size()) != 0) {
+      return false;
+    }
+    data += key.size();
+    GraphSerializer::Read(data, end, entry.graph);
+    GraphSerializer::Read(data, end, entry.reduced_graph);
+    entry.structure_id = readString(data, end);
+  } catch (const std::exception&) {
+    // a corrupt count may also end in bad_alloc or length_error
+    return false;
+  }
+  return data == end;
+}
+
+void GraphCache::Store(const vector<Edge>& edges,
+                       const unordered_map<Index, GraphNode>& nodes,
+                       const string& visitor, const Entry& entry) const {
+  store_(key_(edges, nodes, visitor), entry);
+}
+
+void GraphCache::store_(const vector<char>& key, const Entry& entry) const {
+  std::uint64_t hash = GraphSerializer::ContentHash(key);
+  vector<char> buffer(file_magic, file_magic + sizeof(file_magic));
+  writeValue(file_version, buffer);
+  writeValue(hash, buffer);
+  writeValue(std::uint64_t(key.size()), buffer);
+  buffer.insert(buffer.end(), key.begin(), key.end());
+  GraphSerializer::Write(entry.graph, buffer);
+  GraphSerializer::Write(entry.reduced_graph, buffer);
+  writeString(entry.structure_id, buffer);
+
+  string filename = getFileName(hash);
+  // a random suffix keeps concurrent writers of the same entry apart
+  random_device random;
+  ostringstream temporary;
+  temporary << filename << "." << hex << random() << random() << ".tmp";
+  {
+    ofstream file(temporary.str(), ios::binary | ios::trunc);
+    if (!file) {
+      throw runtime_error("GraphCache: could not write " + temporary.str());
+    }
+    file.write(buffer.data(), streamsize(buffer.size()));
+    if (!file) {
+      throw runtime_error("GraphCache: could not write " + temporary.str());
+    }
+  }
+  if (rename(temporary.str().c_str(), filename.c_str()) != 0) {
+    remove(temporary.str().c_str());
+    throw runtime_error("GraphCache: could not move " + temporary.str() +
+                        " to " + filename);
+  }
+}
+
+}  // namespace tools
+}  // namespace votca
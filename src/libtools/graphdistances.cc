@@ -0,0 +1,155 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+// Local VOTCA includes
+#include "votca/tools/graph.h"
+#include "votca/tools/graphdistances.h"
+#include "votca/tools/threadpool.h"
+
+namespace votca {
+namespace tools {
+
+using namespace std;
+
+GraphDistances::GraphDistances(const Graph& graph) {
+  vertices_ = graph.getVertices();
+  sort(vertices_.begin(), vertices_.end());
+  compact_index_.reserve(vertices_.size());
+  for (Index i = 0; i < Index(vertices_.size()); ++i) {
+    compact_index_[vertices_[i]] = i;
+  }
+
+  offsets_.reserve(vertices_.size() + 1);
+  offsets_.push_back(0);
+  for (Index vertex : vertices_) {
+    for (Index neighbor : graph.getNeighVertices(vertex)) {
+      Index index = compact_index_.at(neighbor);
+      // self loops never shorten a path
+      if (neighbor != vertex) {
+        adjacency_.push_back(index);
+      }
+    }
+    offsets_.push_back(Index(adjacency_.size()));
+  }
+}
+
+Index GraphDistances::compactIndex_(Index vertex) const {
+  auto it = compact_index_.find(vertex);
+  if (it == compact_index_.end()) {
+    throw runtime_error("GraphDistances: vertex " + to_string(vertex) +
+                        " is not part of the graph");
+  }
+  return it->second;
+}
+
+void GraphDistances::search_(Index source, Index max_distance,
+                             Scratch& scratch,
+                             vector<Neighbor>& neighbors) const {
+  neighbors.clear();
+  if (scratch.visited.size() != vertices_.size()) {
+    scratch.visited.assign(vertices_.size(), 0);
+    scratch.epoch = 0;
+  }
+  // marks of earlier searches are invalidated by moving to a new epoch
+  // instead of clearing the whole array
+  Index epoch = ++scratch.epoch;
+  scratch.visited[source] = epoch;
+  scratch.frontier.clear();
+  scratch.frontier.push_back(source);
+
+  for (Index distance = 1;
+       distance <= max_distance && !scratch.frontier.empty(); ++distance) {
+    scratch.next_frontier.clear();
+    for (Index vertex : scratch.frontier) {
+      for (Index k = offsets_[vertex]; k < offsets_[vertex + 1]; ++k) {
+        Index neighbor = adjacency_[k];
+        if (scratch.visited[neighbor] != epoch) {
+          scratch.visited[neighbor] = epoch;
+          scratch.next_frontier.push_back(neighbor);
+        }
+      }
+    }
+    // compact indices follow the vertex ids, so this orders each shell
+    sort(scratch.next_frontier.begin(), scratch.next_frontier.end());
+    for (Index neighbor : scratch.next_frontier) {
+      neighbors.push_back(Neighbor{vertices_[neighbor], distance});
+    }
+    swap(scratch.frontier, scratch.next_frontier);
+  }
+}
+
+vector<GraphDistances::Neighbor> GraphDistances::Neighbors(
+    Index source, Index max_distance) const {
+  Scratch scratch;
+  vector<Neighbor> neighbors;
+  search_(compactIndex_(source), max_distance, scratch, neighbors);
+  return neighbors;
+}
+
+vector<vector<GraphDistances::Neighbor>> GraphDistances::Neighbors(
+    const vector<Index>& sources, Index max_distance) const {
+  vector<Index> compact_sources;
+  compact_sources.reserve(sources.size());
+  for (Index source : sources) {
+    compact_sources.push_back(compactIndex_(source));
+  }
+
+  vector<vector<Neighbor>> result(sources.size());
+  ThreadPool& pool = ThreadPool::Global();
+  // one scratch per chunk of sources, so the result does not depend on which
+  // thread runs a chunk, even if several threads call this at the same time
+  Index nsources = Index(sources.size());
+  Index chunksize = std::max(Index(1), nsources / (4 * pool.size()));
+  Index nchunks = (nsources + chunksize - 1) / chunksize;
+  pool.parallel_for(0, nchunks, [&](Index chunk) {
+    Scratch scratch;
+    Index end = std::min(nsources, (chunk + 1) * chunksize);
+    for (Index i = chunk * chunksize; i < end; ++i) {
+      search_(compact_sources[i], max_distance, scratch, result[i]);
+    }
+  });
+  return result;
+}
+
+vector<vector<GraphDistances::Neighbor>> GraphDistances::AllNeighbors(
+    Index max_distance) const {
+  return Neighbors(vertices_, max_distance);
+}
+
+Eigen::SparseMatrix<Index> GraphDistances::DistanceMatrix(
+    Index max_distance) const {
+  vector<vector<Neighbor>> neighbors = AllNeighbors(max_distance);
+  vector<Eigen::Triplet<Index>> triplets;
+  for (Index i = 0; i < Index(neighbors.size()); ++i) {
+    for (const Neighbor& neighbor : neighbors[i]) {
+      triplets.emplace_back(i, compact_index_.at(neighbor.vertex),
+                            neighbor.distance);
+    }
+  }
+  Index size = Index(vertices_.size());
+  Eigen::SparseMatrix<Index> matrix(size, size);
+  matrix.setFromTriplets(triplets.begin(), triplets.end());
+  return matrix;
+}
+
+}  // namespace tools
+}  // namespace votca
@@ -0,0 +1,317 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <utility>
+
+// Local VOTCA includes
+#include "votca/tools/graph.h"
+#include "votca/tools/graphmatcher.h"
+#include "votca/tools/graphnode.h"
+
+namespace votca {
+namespace tools {
+
+using namespace std;
+
+bool GraphMatcher::CompactGraph::adjacent(Index vertex1, Index vertex2) const {
+  if (degree(vertex1) > degree(vertex2)) {
+    swap(vertex1, vertex2);
+  }
+  return binary_search(adjacency.begin() + offsets[vertex1],
+                       adjacency.begin() + offsets[vertex1 + 1], vertex2);
+}
+
+GraphMatcher::GraphMatcher(const Graph& pattern) {
+  for (const pair<Index, GraphNode>& id_and_node : pattern.getNodes()) {
+    label_ids_.emplace(id_and_node.second.getStringId(),
+                       Index(label_ids_.size()));
+  }
+  pattern_ = compact_(pattern);
+  matchOrder_();
+}
+
+/**
+ * Vertices are numbered by their position in the sorted vertex list. Labels
+ * are the ids the pattern assigned to the string ids of its nodes, a target
+ * node whose string id does not occur in the pattern gets the label -1 and
+ * can never be matched.
+ **/
+GraphMatcher::CompactGraph GraphMatcher::compact_(const Graph& graph) const {
+  CompactGraph compact;
+  compact.vertices = graph.getVertices();
+  sort(compact.vertices.begin(), compact.vertices.end());
+  unordered_map<Index, Index> index;
+  index.reserve(compact.vertices.size());
+  for (Index i = 0; i < compact.size(); ++i) {
+    index[compact.vertices[i]] = i;
+  }
+
+  compact.labels.reserve(compact.vertices.size());
+  compact.offsets.reserve(compact.vertices.size() + 1);
+  compact.offsets.push_back(0);
+  for (Index i = 0; i < compact.size(); ++i) {
+    Index vertex = compact.vertices[i];
+    auto label = label_ids_.find(graph.getNode(vertex).getStringId());
+    compact.labels.push_back(label == label_ids_.end() ? -1 : label->second);
+
+    Index start = Index(compact.adjacency.size());
+    for (Index neighbor : graph.getNeighVertices(vertex)) {
+      if (neighbor != vertex) {
+        compact.adjacency.push_back(index.at(neighbor));
+      }
+    }
+    auto first = compact.adjacency.begin() + start;
+    sort(first, compact.adjacency.end());
+    compact.adjacency.erase(unique(first, compact.adjacency.end()),
+                            compact.adjacency.end());
+    compact.offsets.push_back(Index(compact.adjacency.size()));
+  }
+  return compact;
+}
+
+/**
+ * Each connected component of the pattern is started at its vertex with the
+ * highest degree and then traversed breadth first, visiting neighbors with a
+ * high degree first. Every vertex apart from the roots remembers the earlier
+ * vertex it was reached from, the candidates for the vertex are then the
+ * neighbors of the target vertex that earlier vertex was matched to.
+ **/
+void GraphMatcher::matchOrder_() {
+  Index size = pattern_.size();
+  vector<bool> placed(size, false);
+  order_.clear();
+  order_parent_.clear();
+  vector<Index> neighbors;
+  while (Index(order_.size()) < size) {
+    Index root = -1;
+    for (Index vertex = 0; vertex < size; ++vertex) {
+      if (!placed[vertex] &&
+          (root < 0 || pattern_.degree(vertex) > pattern_.degree(root))) {
+        root = vertex;
+      }
+    }
+    placed[root] = true;
+    size_t queue_front = order_.size();
+    order_.push_back(root);
+    order_parent_.push_back(-1);
+    while (queue_front < order_.size()) {
+      Index vertex = order_[queue_front++];
+      neighbors.assign(
+          pattern_.adjacency.begin() + pattern_.offsets[vertex],
+          pattern_.adjacency.begin() + pattern_.offsets[vertex + 1]);
+      stable_sort(neighbors.begin(), neighbors.end(), [&](Index a, Index b) {
+        return pattern_.degree(a) > pattern_.degree(b);
+      });
+      for (Index neighbor : neighbors) {
+        if (!placed[neighbor]) {
+          placed[neighbor] = true;
+          order_.push_back(neighbor);
+          order_parent_.push_back(vertex);
+        }
+      }
+    }
+  }
+}
+
+bool GraphMatcher::search_(const CompactGraph& target, bool isomorphism,
+                           Index depth, vector<Index>& mapping,
+                           vector<Index>& preimage, Index max_matches,
+                           vector<vector<Index>>& matches) const {
+  if (depth == pattern_.size()) {
+    matches.push_back(mapping);
+    return max_matches > 0 && Index(matches.size()) >= max_matches;
+  }
+
+  Index vertex = order_[depth];
+  Index parent = order_parent_[depth];
+  Index label = pattern_.labels[vertex];
+  Index degree = pattern_.degree(vertex);
+
+  auto feasible = [&](Index candidate) {
+    if (preimage[candidate] >= 0 || target.labels[candidate] != label) {
+      return false;
+    }
+    Index target_degree = target.degree(candidate);
+    if (isomorphism ? target_degree != degree : target_degree < degree) {
+      return false;
+    }
+    // every matched neighbor of the vertex has to be matched to a neighbor of
+    // the candidate
+    Index matched_neighbors = 0;
+    for (Index k = pattern_.offsets[vertex]; k < pattern_.offsets[vertex + 1];
+         ++k) {
+      Index image = mapping[pattern_.adjacency[k]];
+      if (image >= 0) {
+        if (!target.adjacent(candidate, image)) {
+          return false;
+        }
+        ++matched_neighbors;
+      }
+    }
+    // for an isomorphism the candidate may not have additional matched
+    // neighbors either
+    if (isomorphism) {
+      for (Index k = target.offsets[candidate];
+           k < target.offsets[candidate + 1]; ++k) {
+        if (preimage[target.adjacency[k]] >= 0 && --matched_neighbors < 0) {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+
+  auto try_candidate = [&](Index candidate) {
+    if (!feasible(candidate)) {
+      return false;
+    }
+    mapping[vertex] = candidate;
+    preimage[candidate] = vertex;
+    bool done = search_(target, isomorphism, depth + 1, mapping, preimage,
+                        max_matches, matches);
+    mapping[vertex] = -1;
+    preimage[candidate] = -1;
+    return done;
+  };
+
+  if (parent >= 0) {
+    Index image = mapping[parent];
+    for (Index k = target.offsets[image]; k < target.offsets[image + 1]; ++k) {
+      if (try_candidate(target.adjacency[k])) {
+        return true;
+      }
+    }
+  } else {
+    for (Index candidate = 0; candidate < target.size(); ++candidate) {
+      if (try_candidate(candidate)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool GraphMatcher::verify_(const CompactGraph& target,
+                           const vector<Index>& mapping) const {
+  if (target.size() != pattern_.size() ||
+      target.adjacency.size() != pattern_.adjacency.size()) {
+    return false;
+  }
+  vector<bool> used(target.vertices.size(), false);
+  for (Index vertex = 0; vertex < pattern_.size(); ++vertex) {
+    Index image = mapping[vertex];
+    if (used[image] || target.labels[image] != pattern_.labels[vertex]) {
+      return false;
+    }
+    used[image] = true;
+  }
+  // with the same number of edges, keeping every pattern edge makes the
+  // mapping an isomorphism
+  for (Index vertex = 0; vertex < pattern_.size(); ++vertex) {
+    for (Index k = pattern_.offsets[vertex]; k < pattern_.offsets[vertex + 1];
+         ++k) {
+      if (!target.adjacent(mapping[vertex],
+                           mapping[pattern_.adjacency[k]])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+unordered_map<Index, Index> GraphMatcher::toMap_(
+    const CompactGraph& target, const vector<Index>& mapping) const {
+  unordered_map<Index, Index> result;
+  result.reserve(mapping.size());
+  for (Index vertex = 0; vertex < pattern_.size(); ++vertex) {
+    result[pattern_.vertices[vertex]] = target.vertices[mapping[vertex]];
+  }
+  return result;
+}
+
+unordered_map<Index, Index> GraphMatcher::Isomorphism(
+    const Graph& target) const {
+  CompactGraph compact = compact_(target);
+  if (compact.size() != pattern_.size() ||
+      compact.adjacency.size() != pattern_.adjacency.size()) {
+    return unordered_map<Index, Index>();
+  }
+
+  string id = target.getId();
+  {
+    lock_guard<mutex> lock(cache_mutex_);
+    auto cached = cache_.find(id);
+    if (cached != cache_.end() && verify_(compact, cached->second)) {
+      return toMap_(compact, cached->second);
+    }
+  }
+
+  // the sorted label and degree pairs have to agree before searching
+  auto signature = [](const CompactGraph& graph) {
+    vector<pair<Index, Index>> pairs;
+    pairs.reserve(graph.vertices.size());
+    for (Index vertex = 0; vertex < graph.size(); ++vertex) {
+      pairs.emplace_back(graph.labels[vertex], graph.degree(vertex));
+    }
+    sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+  if (signature(compact) != signature(pattern_)) {
+    return unordered_map<Index, Index>();
+  }
+
+  vector<Index> mapping(pattern_.vertices.size(), -1);
+  vector<Index> preimage(compact.vertices.size(), -1);
+  vector<vector<Index>> matches;
+  search_(compact, true, 0, mapping, preimage, 1, matches);
+  if (matches.empty()) {
+    return unordered_map<Index, Index>();
+  }
+  {
+    lock_guard<mutex> lock(cache_mutex_);
+    cache_[id] = matches.front();
+  }
+  return toMap_(compact, matches.front());
+}
+
+vector<unordered_map<Index, Index>> GraphMatcher::SubgraphMatches(
+    const Graph& target, Index max_matches) const {
+  vector<unordered_map<Index, Index>> result;
+  CompactGraph compact = compact_(target);
+  if (compact.size() < pattern_.size()) {
+    return result;
+  }
+  vector<Index> mapping(pattern_.vertices.size(), -1);
+  vector<Index> preimage(compact.vertices.size(), -1);
+  vector<vector<Index>> matches;
+  search_(compact, false, 0, mapping, preimage, max_matches, matches);
+  result.reserve(matches.size());
+  for (const vector<Index>& match : matches) {
+    result.push_back(toMap_(compact, match));
+  }
+  return result;
+}
+
+Index GraphMatcher::CacheSize() const {
+  lock_guard<mutex> lock(cache_mutex_);
+  return Index(cache_.size());
+}
+
+}  // namespace tools
+}  // namespace votca
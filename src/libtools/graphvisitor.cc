@@ -34,6 +34,12 @@ namespace tools {
 
 class GraphNode;
 
+set<Index> ExploredVertices::toSet() const {
+  set<Index> vertices;
+  marks_.forEach([&](Index vertex, char) { vertices.insert(vertex); });
+  return vertices;
+}
+
 bool GraphVisitor::queEmpty() const { return true; }
 
 void GraphVisitor::exploreNode(pair<Index, GraphNode>& vertex_and_node, Graph&,
@@ -41,6 +47,20 @@ void GraphVisitor::exploreNode(pair<Index, GraphNode>& vertex_and_node, Graph&,
   explored_.insert(vertex_and_node.first);
 }
 
+Index GraphVisitor::countUnexplored_(const Edge& edge,
+                                     Index& unexplored) const {
+  Index count = 0;
+  if (explored_.count(edge.getEndPoint2()) == 0) {
+    unexplored = edge.getEndPoint2();
+    ++count;
+  }
+  if (explored_.count(edge.getEndPoint1()) == 0) {
+    unexplored = edge.getEndPoint1();
+    ++count;
+  }
+  return count;
+}
+
 vector<Index> GraphVisitor::getUnexploredVertex(const Edge edge) const {
   vector<Index> unexp_vert;
   if (explored_.count(edge.getEndPoint1()) == 0) {
@@ -56,8 +76,12 @@ bool GraphVisitor::vertexExplored(const Index vertex) const {
   return explored_.count(vertex) == 1;
 }
 
+void GraphVisitor::reset() {
+  explored_.clear();
+  clearEdges_();
+}
+
 void GraphVisitor::initialize(Graph& graph) {
-  vector<Edge> neigh_eds = graph.getNeighEdges(startingVertex_);
   GraphNode graph_node = graph.getNode(startingVertex_);
   pair<Index, GraphNode> vertex_and_graph_node(startingVertex_, graph_node);
   exploreNode(vertex_and_graph_node, graph);
@@ -65,40 +89,43 @@ void GraphVisitor::initialize(Graph& graph) {
 }
 
 void GraphVisitor::exec(Graph& graph, Edge edge) {
-  vector<Index> unexp_vert = getUnexploredVertex(edge);
+  Index unexplored_vertex = 0;
+  Index unexplored_count = countUnexplored_(edge, unexplored_vertex);
   // If no vertices are return than just ignore it means the same
   // vertex was explored from a different direction
-  if (!unexp_vert.size()) {
+  if (unexplored_count == 0) {
     return;
   }
   // If two values are returned this is a problem
-  if (unexp_vert.size() > 1) {
+  if (unexplored_count > 1) {
     throw runtime_error(
         "More than one unexplored vertex in an edge,"
         " did you set the starting node");
   }
 
-  pair<Index, GraphNode> vertex_and_node(unexp_vert.at(0),
-                                         graph.getNode(unexp_vert.at(0)));
+  pair<Index, GraphNode> vertex_and_node(unexplored_vertex,
+                                         graph.getNode(unexplored_vertex));
 
   exploreNode(vertex_and_node, graph, edge);
 }
 
-Edge GraphVisitor::nextEdge(Graph graph) {
+Edge GraphVisitor::nextEdge(const Graph& graph) {
 
   // Get the edge and at the same time remove it from whatever queue it is in
 
   Edge edge = getEdge_();
-  vector<Index> unexplored_vertices = getUnexploredVertex(edge);
+  Index unexplored_vertex = 0;
   // Do not add neighboring edges if they belong to a vertex that has already
   // been explored because they will have already been added
-  if (unexplored_vertices.size()) {
-    addEdges_(graph, unexplored_vertices.at(0));
+  if (countUnexplored_(edge, unexplored_vertex)) {
+    addEdges_(graph, unexplored_vertex);
   }
   return edge;
 }
 
-set<Index> GraphVisitor::getExploredVertices() const { return explored_; }
+set<Index> GraphVisitor::getExploredVertices() const {
+  return explored_.toSet();
+}
 
 }  // namespace tools
 }  // namespace votca
@@ -16,12 +16,16 @@
  */
 
 // Standard includes
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <limits>
 #include <numeric>
 
 // Local VOTCA includes
 #include "votca/tools/histogram.h"
+#include "votca/tools/profiler.h"
+#include "votca/tools/threadpool.h"
 
 namespace votca {
 namespace tools {
@@ -33,7 +37,7 @@ Histogram::Histogram(const options_t& op) : _options(op) {}
 Histogram::~Histogram() = default;
 
 void Histogram::ProcessData(DataCollection<double>::selection* data) {
-
+  VOTCA_PROFILE_REGION("Histogram::ProcessData");
   _pdf.assign(_options._n, 0);
 
   if (_options._auto_interval) {
@@ -55,10 +59,17 @@ void Histogram::ProcessData(DataCollection<double>::selection* data) {
 
   _interval = (_max - _min) / (double)(_options._n - 1);
 
-  double v = 1.;
+  // below this size starting the threads costs more than binning
+  const Index min_parallel_size = 100000;
+  // every thread counts into its own bins, the counts are integers so the
+  // sum does not depend on the number of threads
+  ThreadPool& pool = ThreadPool::Global();
+  WorkerLocal<std::vector<double>> pdfs(pool, _pdf);
   for (auto& array : *data) {
-    for (auto& value : *array) {
-      Index ii = (Index)floor((value - _min) / _interval +
+    Index size = Index(array->size());
+    Index max_threads = (size < min_parallel_size) ? 1 : 0;
+    auto count = [&](Index i) {
+      Index ii = (Index)floor(((*array)[i] - _min) / _interval +
                               0.5);  // the interval should
                                      // be centered around
                                      // the sampling point
@@ -69,11 +80,16 @@ void Histogram::ProcessData(DataCollection<double>::selection* data) {
           }
           ii = ii % _options._n;
         } else {
-          continue;
+          return;
         }
       }
-      _pdf[ii] += v;
-    }
+      pdfs.local()[ii] += 1.;
+    };
+    pool.parallel_for(0, size, count, 0, max_threads);
+  }
+  for (const std::vector<double>& pdf : pdfs) {
+    std::transform(_pdf.begin(), _pdf.end(), pdf.begin(), _pdf.begin(),
+                   std::plus<double>());
   }
 
   if (_options._scale == "bond") {
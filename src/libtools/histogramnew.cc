@@ -52,8 +52,7 @@ void HistogramNew::Initialize(double min, double max, Index nbins) {
   Initialize_();
 }
 
-void HistogramNew::Process(const double &v, double scale) {
-
+Index HistogramNew::bin(double v) const {
   Index i = (Index)floor((v - _min) / _step + 0.5);
   if (i < 0 || i >= _nbins) {
     if (_periodic) {
@@ -63,10 +62,17 @@ void HistogramNew::Process(const double &v, double scale) {
         i = i % _nbins;
       }
     } else {
-      return;
+      return -1;
     }
   }
-  _data.y(i) += scale;
+  return i;
+}
+
+void HistogramNew::Process(const double &v, double scale) {
+  Index i = bin(v);
+  if (i >= 0) {
+    _data.y(i) += scale;
+  }
 }
 
 double HistogramNew::getMinBinVal() const { return _data.getMinY(); }
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <stdexcept>
+
+// Local VOTCA includes
+#include "votca/tools/jobengine.h"
+#include "votca/tools/propertyiomanipulator.h"
+
+namespace votca {
+namespace tools {
+
+Job::Job(const Property &job) : _output("output", "", "") {
+  _id = job.get("id").as<Index>();
+  _tag = job.ifExistsReturnElseReturnDefault<std::string>("tag", "");
+  if (job.exists("input")) {
+    _input = job.get("input");
+  } else {
+    _input = Property("input", "", "");
+  }
+  if (job.exists("output")) {
+    _output = job.get("output");
+  }
+  _status = AVAILABLE;
+  if (job.exists("status")) {
+    _status = StringToStatus(job.get("status").as<std::string>());
+  }
+}
+
+std::string Job::StatusToString(Status status) {
+  switch (status) {
+    case AVAILABLE:
+      return "AVAILABLE";
+    case COMPLETE:
+      return "COMPLETE";
+    case FAILED:
+      return "FAILED";
+  }
+  throw std::runtime_error("Unknown job status");
+}
+
+Job::Status Job::StringToStatus(const std::string &status) {
+  if (status == "AVAILABLE") {
+    return AVAILABLE;
+  } else if (status == "COMPLETE") {
+    return COMPLETE;
+  } else if (status == "FAILED") {
+    return FAILED;
+  }
+  throw std::runtime_error("Unknown job status '" + status + "'");
+}
+
+void Job::AddToProperty(Property &jobs) const {
+  Property &job = jobs.add("job", "");
+  job.add("id", std::to_string(_id));
+  job.add("tag", _tag);
+  Property &input = job.add("input", "");
+  input = _input;
+  job.add("status", StatusToString(_status));
+  if (_output.HasChildren() || !_output.value().empty()) {
+    Property &output = job.add("output", "");
+    output = _output;
+  }
+}
+
+JobEngine::JobEngine(const Property &jobfile) {
+  for (const Property *job : jobfile.Select("jobs.job")) {
+    _jobs.emplace_back(*job);
+  }
+}
+
+void JobEngine::setCheckpointFile(const std::string &filename) {
+  _checkpoint_file = filename;
+  _checkpointed.clear();
+  std::ifstream in(filename);
+  Index id;
+  while (in >> id) {
+    _checkpointed.insert(id);
+  }
+}
+
+void JobEngine::Run(const CalculatorFactory &factory, ThreadPool &pool) {
+  std::vector<Index> todo;
+  for (Index i = 0; i < NumberOfJobs(); i++) {
+    Job &job = _jobs[i];
+    if (job.getStatus() != Job::AVAILABLE) {
+      continue;
+    }
+    if (_checkpointed.count(job.getId())) {
+      job.setStatus(Job::COMPLETE);
+    } else {
+      todo.push_back(i);
+    }
+  }
+
+  _ntotal = Index(todo.size());
+  _nfinished = 0;
+  if (_ntotal == 0) {
+    return;
+  }
+  LockFreeQueue<Index> queue(_ntotal);
+  for (Index i : todo) {
+    queue.push(i);
+  }
+  _finished_jobs = std::make_unique<LockFreeQueue<Index>>(_ntotal);
+  if (!_checkpoint_file.empty()) {
+    _checkpoint.open(_checkpoint_file, std::ios::out | std::ios::app);
+    if (!_checkpoint) {
+      throw std::runtime_error("Could not open checkpoint file " +
+                               _checkpoint_file);
+    }
+  }
+
+  auto run_jobs = [&](Index) {
+    std::unique_ptr<JobCalculator> calculator;
+    Index i;
+    while (queue.pop(i)) {
+      if (!calculator) {
+        calculator = factory();
+      }
+      Job &job = _jobs[i];
+      bool success = false;
+      try {
+        success = calculator->EvalJob(job.getInput(), job.getOutput());
+      } catch (const std::exception &error) {
+        job.getOutput().add("error", error.what());
+      } catch (...) {
+        job.getOutput().add("error", "unknown exception");
+      }
+      job.setStatus(success ? Job::COMPLETE : Job::FAILED);
+      _nfinished++;
+      _finished_jobs->push(i);
+      Flush(false);
+    }
+  };
+  try {
+    pool.parallel_for(0, std::min(pool.size(), _ntotal), run_jobs, 1);
+  } catch (...) {
+    // e.g. the factory failed, the jobs finished so far are still recorded
+    Flush(true);
+    if (_checkpoint.is_open()) {
+      _checkpoint.close();
+    }
+    throw;
+  }
+  Flush(true);
+  if (_checkpoint.is_open()) {
+    _checkpoint.close();
+  }
+}
+
+void JobEngine::Flush(bool wait) {
+  std::unique_lock<std::mutex> lock(_flush_mutex, std::defer_lock);
+  if (wait) {
+    lock.lock();
+  } else if (!lock.try_lock()) {
+    // somebody else is already writing, the job is picked up later
+    return;
+  }
+  bool flushed = false;
+  Index i;
+  while (_finished_jobs->pop(i)) {
+    flushed = true;
+    if (_checkpoint.is_open() && _jobs[i].getStatus() == Job::COMPLETE) {
+      _checkpoint << _jobs[i].getId() << '\n';
+    }
+  }
+  if (flushed) {
+    if (_checkpoint.is_open()) {
+      _checkpoint.flush();
+    }
+    if (_progress) {
+      _progress(_nfinished, _ntotal);
+    }
+  }
+}
+
+Index JobEngine::NumberOfCompletedJobs() const {
+  return Index(std::count_if(_jobs.begin(), _jobs.end(), [](const Job &job) {
+    return job.getStatus() == Job::COMPLETE;
+  }));
+}
+
+Index JobEngine::NumberOfFailedJobs() const {
+  return Index(std::count_if(_jobs.begin(), _jobs.end(), [](const Job &job) {
+    return job.getStatus() == Job::FAILED;
+  }));
+}
+
+Property JobEngine::Results() const {
+  Property results;
+  Property &jobs = results.add("jobs", "");
+  for (const Job &job : _jobs) {
+    job.AddToProperty(jobs);
+  }
+  return results;
+}
+
+void JobEngine::WriteResults(const std::string &filename) const {
+  std::ofstream ofs(filename);
+  if (!ofs) {
+    throw std::runtime_error("Could not create " + filename);
+  }
+  // skip the unnamed root node
+  PropertyIOManipulator iom(PropertyIOManipulator::XML, 1, "");
+  ofs << iom << Results();
+}
+
+}  // namespace tools
+}  // namespace votca
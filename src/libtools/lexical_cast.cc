@@ -0,0 +1,90 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
+// Local VOTCA includes
+#include "votca/tools/lexical_cast.h"
+
+namespace votca {
+namespace tools {
+
+namespace {
+
+// the C parsers need a terminated string, short tokens are copied to the
+// stack, only very long ones need a heap copy
+template <typename T, typename Parser>
+T ParseToken(boost::string_ref token, Parser parse) {
+  if (token.empty() || std::isspace(static_cast<unsigned char>(token[0]))) {
+    throw boost::bad_lexical_cast(typeid(std::string), typeid(T));
+  }
+  constexpr std::size_t buffersize = 64;
+  char buffer[buffersize];
+  std::string heap;
+  const char *begin = buffer;
+  if (token.size() < buffersize) {
+    std::copy(token.begin(), token.end(), buffer);
+    buffer[token.size()] = '\0';
+  } else {
+    heap = token.to_string();
+    begin = heap.c_str();
+  }
+  char *end = nullptr;
+  errno = 0;
+  T result = parse(begin, &end);
+  if (end != begin + token.size() || errno == ERANGE) {
+    throw boost::bad_lexical_cast(typeid(std::string), typeid(T));
+  }
+  return result;
+}
+
+}  // namespace
+
+double TokenToDouble(boost::string_ref token) {
+  return ParseToken<double>(token, [](const char *str, char **end) {
+    double value = std::strtod(str, end);
+    // underflow to a denormal or zero is fine, only overflow is an error
+    if (errno == ERANGE && !std::isinf(value)) {
+      errno = 0;
+    }
+    return value;
+  });
+}
+
+long long TokenToLongLong(boost::string_ref token) {
+  return ParseToken<long long>(token, [](const char *str, char **end) {
+    return std::strtoll(str, end, 10);
+  });
+}
+
+unsigned long long TokenToULongLong(boost::string_ref token) {
+  if (!token.empty() && token[0] == '-') {
+    throw boost::bad_lexical_cast(typeid(std::string),
+                                  typeid(unsigned long long));
+  }
+  return ParseToken<unsigned long long>(
+      token,
+      [](const char *str, char **end) { return std::strtoull(str, end, 10); });
+}
+
+}  // namespace tools
+}  // namespace votca
@@ -16,11 +16,15 @@
  */
 
 // Standard includes
+#include <algorithm>
 #include <iostream>
+#include <random>
 #include <sstream>
 
 // Local VOTCA includes
 #include "votca/tools/linalg.h"
+#include "votca/tools/profiler.h"
+#include "votca/tools/threadpool.h"
 
 namespace votca {
 namespace tools {
@@ -28,6 +32,7 @@ namespace tools {
 Eigen::VectorXd linalg_constrained_qrsolve(const Eigen::MatrixXd &A,
                                            const Eigen::VectorXd &b,
                                            const Eigen::MatrixXd &constr) {
+  VOTCA_PROFILE_REGION("linalg_constrained_qrsolve");
   // check matrix for zero column
 
   bool nonzero_found = false;
@@ -63,9 +68,124 @@ Eigen::VectorXd linalg_constrained_qrsolve(const Eigen::MatrixXd &A,
   return QR.householderQ() * result;
 }
 
-EigenSystem linalg_eigenvalues(Eigen::MatrixXd &A, Index nmax) {
+void DenseOperator::matmul(const Eigen::VectorXd &x,
+                           Eigen::VectorXd &y) const {
+  const Index n = _A.rows();
+  // small problems are not worth the overhead of distributing the work
+  const Index min_rows_per_block = 256;
+  Index nblocks = std::min(_nthreads, n / min_rows_per_block);
+  if (nblocks < 2) {
+    y.noalias() = _A * x;
+    return;
+  }
+  // A is symmetric, so the rows of A are the columns of A, which are
+  // contiguous in memory
+  Index blocksize = (n + nblocks - 1) / nblocks;
+  ThreadPool::Global().parallel_for(0, nblocks, [&](Index block) {
+    Index start = block * blocksize;
+    Index length = std::min(blocksize, n - start);
+    y.segment(start, length).noalias() =
+        _A.middleCols(start, length).transpose() * x;
+  });
+}
+
+namespace {
+// orthogonalises v against the first ncols columns of V with two passes of
+// classical Gram-Schmidt and normalises it, returns the norm before
+// normalisation
+double orthonormalize(const Eigen::MatrixXd &V, Index ncols,
+                      Eigen::VectorXd &v) {
+  for (Index pass = 0; pass < 2; pass++) {
+    Eigen::VectorXd overlap = V.leftCols(ncols).transpose() * v;
+    v.noalias() -= V.leftCols(ncols) * overlap;
+  }
+  double norm = v.norm();
+  v /= norm;
+  return norm;
+}
+}  // namespace
+
+EigenSystem linalg_lanczos_eigenvalues(const MatrixFreeOperator &A, Index nmax,
+                                       double tol, Index max_restarts) {
+  VOTCA_PROFILE_REGION("linalg_lanczos_eigenvalues");
+  const Index n = A.size();
+  if (nmax > n || nmax < 1) {
+    throw std::runtime_error(
+        "linalg_lanczos_eigenvalues: nmax must be between 1 and " +
+        std::to_string(n));
+  }
+  // size of the Krylov subspace and number of Ritz vectors kept on restart
+  const Index m = std::min(n, std::max(2 * nmax, nmax + 20));
+  const Index keep = std::min(nmax + (m - nmax) / 2, m - 1);
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  auto random_vector = [&]() {
+    Eigen::VectorXd v(n);
+    for (Index i = 0; i < n; i++) {
+      v[i] = dist(gen);
+    }
+    return v;
+  };
+
+  // V has one column more than the subspace to hold the next Lanczos vector
+  Eigen::MatrixXd V = Eigen::MatrixXd::Zero(n, m + 1);
+  Eigen::MatrixXd AV = Eigen::MatrixXd::Zero(n, m);
+  Eigen::VectorXd v = random_vector();
+  V.col(0) = v / v.norm();
+  Index start = 0;
 
   EigenSystem result;
+  for (Index restart = 0; restart <= max_restarts; restart++) {
+    for (Index j = start; j < m; j++) {
+      Eigen::VectorXd w = Eigen::VectorXd::Zero(n);
+      A.matmul(V.col(j), w);
+      AV.col(j) = w;
+      if (j + 1 == n) {
+        break;  // the subspace spans the full space
+      }
+      double wnorm = w.norm();
+      double norm = orthonormalize(V, j + 1, w);
+      // breakdown, the subspace is invariant so continue with a random vector
+      while (!(norm > 1e-12 * wnorm)) {
+        w = random_vector();
+        wnorm = w.norm();
+        norm = orthonormalize(V, j + 1, w);
+      }
+      V.col(j + 1) = w;
+    }
+
+    // Rayleigh-Ritz in the Krylov subspace
+    Eigen::MatrixXd T = V.leftCols(m).transpose() * AV;
+    T = 0.5 * (T + T.transpose()).eval();
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(T);
+    const Eigen::VectorXd &theta = es.eigenvalues();
+    const Eigen::MatrixXd &S = es.eigenvectors();
+
+    result.eigenvectors() = V.leftCols(m) * S.leftCols(nmax);
+    result.eigenvalues() = theta.head(nmax);
+    Eigen::MatrixXd residual =
+        AV * S.leftCols(nmax) -
+        result.eigenvectors() * theta.head(nmax).asDiagonal();
+    double scale = std::max(1.0, theta.cwiseAbs().maxCoeff());
+    if (m == n || residual.colwise().norm().maxCoeff() < tol * scale) {
+      result.info() = Eigen::Success;
+      return result;
+    }
+
+    // thick restart: keep the lowest Ritz vectors and the next Lanczos vector
+    V.leftCols(keep) = V.leftCols(m) * S.leftCols(keep);
+    AV.leftCols(keep) = AV * S.leftCols(keep);
+    V.col(keep) = V.col(m);
+    start = keep;
+  }
+  result.info() = Eigen::NoConvergence;
+  return result;
+}
+
+EigenSystem linalg_eigenvalues(Eigen::MatrixXd &A, Index nmax) {
+  VOTCA_PROFILE_REGION("linalg_eigenvalues");
+  EigenSystem result;
 #ifdef MKL_FOUND
 
   Index n = A.rows();
@@ -101,6 +221,16 @@ EigenSystem linalg_eigenvalues(Eigen::MatrixXd &A, Index nmax) {
   }
 
 #else
+  // only a few eigenvalues of a large matrix are requested, so a partial
+  // solver is much cheaper than a full diagonalisation
+  const Index min_lanczos_size = 500;
+  if (A.rows() >= min_lanczos_size && 10 * nmax < A.rows()) {
+    result = linalg_lanczos_eigenvalues(
+        DenseOperator(A, ThreadPool::Global().size()), nmax);
+    if (result.info() == Eigen::Success) {
+      return result;
+    }
+  }
   Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(A);
   result.eigenvectors() = es.eigenvectors().leftCols(nmax);
   result.eigenvalues() = es.eigenvalues().head(nmax);
@@ -29,5 +29,7 @@ void Mutex::Lock() { pthread_mutex_lock(&_mutexVar); }
 
 void Mutex::Unlock() { pthread_mutex_unlock(&_mutexVar); }
 
+bool Mutex::try_lock() { return pthread_mutex_trylock(&_mutexVar) == 0; }
+
 }  // namespace tools
 }  // namespace votca
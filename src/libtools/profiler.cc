@@ -0,0 +1,310 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+
+// Third party includes
+#include <boost/format.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/profiler.h"
+
+namespace votca {
+namespace tools {
+
+struct Profiler::ThreadData {
+  struct Node {
+    const char* name;
+    Index parent;
+    std::vector<Index> children;
+    Index calls = 0;
+    double total = 0.0;
+    double min = std::numeric_limits<double>::max();
+    double max = 0.0;
+  };
+
+  struct Event {
+    Index node;
+    double start;
+    double duration;
+  };
+
+  explicit ThreadData(Index id) : thread_id(id) { clear(); }
+
+  void clear() {
+    nodes.assign(1, Node{"", -1, {}});
+    current = 0;
+    counters.clear();
+    events.clear();
+    dropped_events = 0;
+  }
+
+  HybridLock lock;
+  Index thread_id;
+  // nodes[0] is the root of the call tree of this thread
+  std::vector<Node> nodes;
+  Index current = 0;
+  std::vector<std::pair<const char*, Index>> counters;
+  std::vector<Event> events;
+  Index dropped_events = 0;
+};
+
+namespace {
+
+// names are usually the same literal, comparing the pointers first avoids
+// most string comparisons
+bool sameName(const char* a, const char* b) {
+  return a == b || std::strcmp(a, b) == 0;
+}
+
+std::string escapeJSON(const std::string& text) {
+  std::string escaped;
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+      escaped += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      escaped += (boost::format("\\u%04x") % int(c)).str();
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+}  // namespace
+
+Profiler& Profiler::Global() {
+  static Profiler profiler;
+  return profiler;
+}
+
+void Profiler::Enable(bool trace, Index max_events) {
+  if (!isEnabled()) {
+    _start.store(Clock::now().time_since_epoch().count(),
+                 std::memory_order_relaxed);
+  }
+  _max_events.store(max_events, std::memory_order_relaxed);
+  _trace.store(trace, std::memory_order_relaxed);
+  _enabled.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::Reset() {
+  std::lock_guard<std::mutex> guard(_threads_mutex);
+  for (auto& data : _threads) {
+    ScopedLock<HybridLock> lock(data->lock);
+    data->clear();
+  }
+  _start.store(Clock::now().time_since_epoch().count(),
+               std::memory_order_relaxed);
+}
+
+Profiler::ThreadData& Profiler::threadData_() {
+  // the data is owned by the profiler, so it is still available after the
+  // thread has finished
+  thread_local ThreadData* data = nullptr;
+  if (data == nullptr) {
+    std::lock_guard<std::mutex> guard(_threads_mutex);
+    _threads.push_back(
+        std::unique_ptr<ThreadData>(new ThreadData(Index(_threads.size()))));
+    data = _threads.back().get();
+  }
+  return *data;
+}
+
+void Profiler::enter_(ThreadData& data, const char* name) {
+  ScopedLock<HybridLock> lock(data.lock);
+  for (Index child : data.nodes[data.current].children) {
+    if (sameName(data.nodes[child].name, name)) {
+      data.current = child;
+      return;
+    }
+  }
+  Index child = Index(data.nodes.size());
+  data.nodes.push_back(ThreadData::Node{name, data.current, {}});
+  data.nodes[data.current].children.push_back(child);
+  data.current = child;
+}
+
+void Profiler::leave_(ThreadData& data, Clock::time_point start) {
+  Clock::time_point stop = Clock::now();
+  double duration = std::chrono::duration<double>(stop - start).count();
+  ScopedLock<HybridLock> lock(data.lock);
+  ThreadData::Node& node = data.nodes[data.current];
+  node.calls++;
+  node.total += duration;
+  node.min = std::min(node.min, duration);
+  node.max = std::max(node.max, duration);
+  if (_trace.load(std::memory_order_relaxed)) {
+    if (Index(data.events.size()) <
+        _max_events.load(std::memory_order_relaxed)) {
+      Clock::time_point origin(
+          Clock::duration(_start.load(std::memory_order_relaxed)));
+      double offset = std::chrono::duration<double>(start - origin).count();
+      data.events.push_back({data.current, offset, duration});
+    } else {
+      data.dropped_events++;
+    }
+  }
+  data.current = std::max(node.parent, Index(0));
+}
+
+void Profiler::Count(const char* name, Index n) {
+  ThreadData& data = threadData_();
+  ScopedLock<HybridLock> lock(data.lock);
+  for (auto& counter : data.counters) {
+    if (sameName(counter.first, name)) {
+      counter.second += n;
+      return;
+    }
+  }
+  data.counters.emplace_back(name, n);
+}
+
+std::vector<Profiler::Region> Profiler::getRegions() const {
+  // lexicographic order of the paths puts parents before their children
+  std::map<std::vector<std::string>, Region> merged;
+  std::lock_guard<std::mutex> guard(_threads_mutex);
+  for (const auto& data : _threads) {
+    ScopedLock<HybridLock> lock(data->lock);
+    std::vector<std::vector<std::string>> paths(data->nodes.size());
+    // children are always created after their parents
+    for (Index i = 1; i < Index(data->nodes.size()); ++i) {
+      const ThreadData::Node& node = data->nodes[i];
+      paths[i] = paths[node.parent];
+      paths[i].push_back(node.name);
+      if (node.calls == 0) {
+        continue;
+      }
+      Region& region = merged[paths[i]];
+      if (region.calls == 0) {
+        region.path = paths[i];
+        region.min = node.min;
+        region.max = node.max;
+      } else {
+        region.min = std::min(region.min, node.min);
+        region.max = std::max(region.max, node.max);
+      }
+      region.calls += node.calls;
+      region.total += node.total;
+    }
+  }
+  std::vector<Region> regions;
+  regions.reserve(merged.size());
+  for (auto& entry : merged) {
+    regions.push_back(std::move(entry.second));
+  }
+  return regions;
+}
+
+std::vector<Profiler::Counter> Profiler::getCounters() const {
+  std::map<std::string, Index> merged;
+  std::lock_guard<std::mutex> guard(_threads_mutex);
+  for (const auto& data : _threads) {
+    ScopedLock<HybridLock> lock(data->lock);
+    for (const auto& counter : data->counters) {
+      merged[counter.first] += counter.second;
+    }
+  }
+  std::vector<Counter> counters;
+  for (const auto& entry : merged) {
+    counters.push_back({entry.first, entry.second});
+  }
+  return counters;
+}
+
+void Profiler::WriteSummary(std::ostream& out) const {
+  std::vector<Region> regions = getRegions();
+  std::vector<Counter> counters = getCounters();
+  boost::format line("%|-48| %|10| %|14| %|14| %|14| %|14|\n");
+  out << "Profile of votca_tools regions, times are summed over all threads\n";
+  out << line % "region" % "calls" % "total [ms]" % "mean [ms]" % "min [ms]" %
+             "max [ms]";
+  for (const Region& region : regions) {
+    std::string name =
+        std::string(2 * (region.path.size() - 1), ' ') + region.path.back();
+    out << line % name % region.calls %
+               (boost::format("%.3f") % (1e3 * region.total)) %
+               (boost::format("%.3f") %
+                (1e3 * region.total / double(region.calls))) %
+               (boost::format("%.3f") % (1e3 * region.min)) %
+               (boost::format("%.3f") % (1e3 * region.max));
+  }
+  if (!counters.empty()) {
+    out << "\n" << boost::format("%|-48| %|10|\n") % "counter" % "value";
+    for (const Counter& counter : counters) {
+      out << boost::format("%|-48| %|10|\n") % counter.name % counter.value;
+    }
+  }
+}
+
+void Profiler::WriteChromeTrace(std::ostream& out) const {
+  std::lock_guard<std::mutex> guard(_threads_mutex);
+  out << std::fixed << std::setprecision(3);
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  auto separator = [&]() {
+    out << (first ? "\n" : ",\n");
+    first = false;
+  };
+  double end = 0.0;
+  Index dropped_events = 0;
+  std::map<std::string, Index> counters;
+  for (const auto& data : _threads) {
+    ScopedLock<HybridLock> lock(data->lock);
+    separator();
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+        << data->thread_id << ",\"args\":{\"name\":\"thread "
+        << data->thread_id << "\"}}";
+    for (const ThreadData::Event& event : data->events) {
+      separator();
+      // timestamps are in microseconds
+      out << "{\"name\":\"" << escapeJSON(data->nodes[event.node].name)
+          << "\",\"cat\":\"votca\",\"ph\":\"X\",\"ts\":" << 1e6 * event.start
+          << ",\"dur\":" << 1e6 * event.duration
+          << ",\"pid\":0,\"tid\":" << data->thread_id << "}";
+      end = std::max(end, event.start + event.duration);
+    }
+    dropped_events += data->dropped_events;
+    for (const auto& counter : data->counters) {
+      counters[counter.first] += counter.second;
+    }
+  }
+  if (!counters.empty()) {
+    separator();
+    out << "{\"name\":\"counters\",\"ph\":\"C\",\"ts\":" << 1e6 * end
+        << ",\"pid\":0,\"args\":{";
+    bool first_counter = true;
+    for (const auto& counter : counters) {
+      out << (first_counter ? "" : ",") << "\"" << escapeJSON(counter.first)
+          << "\":" << counter.second;
+      first_counter = false;
+    }
+    out << "}}";
+  }
+  out << "\n],\n\"displayTimeUnit\":\"ms\",\n";
+  out << "\"otherData\":{\"dropped_events\":" << dropped_events << "}}\n";
+}
+
+}  // namespace tools
+}  // namespace votca
@@ -32,6 +32,7 @@
 
 // Local VOTCA includes
 #include "votca/tools/colors.h"
+#include "votca/tools/profiler.h"
 #include "votca/tools/property.h"
 #include "votca/tools/propertyiomanipulator.h"
 #include "votca/tools/tokenizer.h"
@@ -43,33 +44,14 @@ using namespace std;
 const Index Property::IOindex = std::ios_base::xalloc();
 
 const Property &Property::get(const string &key) const {
-  Tokenizer tok(key, ".");
-  Tokenizer::iterator n = tok.begin();
-  if (n == tok.end()) {
-    return *this;
-  }
-
-  const Property *p;
-  map<string, Index>::const_iterator iter;
-  if (*n == "") {
-    p = this;
-  } else {
-    iter = _map.find(*n);
-    if (iter == _map.end()) {
+  const Property *p = this;
+  for (boost::string_ref name : TokenizerView(key, ".")) {
+    auto iter = p->_map.find(name);
+    if (iter == p->_map.end()) {
       throw std::runtime_error("property not found: " + key);
     }
-    p = &_properties[((*iter).second)];
+    p = &p->_properties[iter->second];
   }
-  ++n;
-  try {
-    for (; n != tok.end(); ++n) {
-      p = &p->get(*n);
-    }
-  } catch (std::runtime_error &) {  // catch here to get full key in
-                                    // exception
-    throw std::runtime_error("property not found: " + key);
-  }
-
   return *p;
 }
 
@@ -156,6 +138,7 @@ void char_hndl(void *data, const char *txt, int txtlen) {
 }
 
 void Property::LoadFromXML(string filename) {
+  VOTCA_PROFILE_REGION("Property::LoadFromXML");
   ifstream fl;
   fl.open(filename);
   if (!fl.is_open()) {
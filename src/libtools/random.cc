@@ -0,0 +1,118 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+
+// Local VOTCA includes
+#include "votca/tools/constants.h"
+#include "votca/tools/random.h"
+#include "votca/tools/threadpool.h"
+
+namespace votca {
+namespace tools {
+
+namespace {
+
+// splitmix64 finalizer, spreads derived stream ids over the whole range
+std::uint64_t Mix(std::uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xBF58476D1CE4E5B9ull;
+  x ^= x >> 27;
+  x *= 0x94D049BB133111EBull;
+  x ^= x >> 31;
+  return x;
+}
+
+// Box-Muller, u1 is from [0,1), so 1-u1 is never zero
+void BoxMuller(double u1, double u2, double &n1, double &n2) {
+  double r = std::sqrt(-2.0 * std::log(1.0 - u1));
+  double phi = 2.0 * conv::Pi * u2;
+  n1 = r * std::cos(phi);
+  n2 = r * std::sin(phi);
+}
+
+}  // namespace
+
+ParallelRandom ParallelRandom::Substream(Index id) const {
+  ParallelRandom result;
+  result._int_distribution = _int_distribution;
+  std::uint64_t stream = Mix(_engine.getStream() +
+                             0x9E3779B97F4A7C15ull * (std::uint64_t(id) + 1));
+  result._engine = _engine.Stream(stream);
+  return result;
+}
+
+double ParallelRandom::rand_normal() {
+  if (_has_normal) {
+    _has_normal = false;
+    return _normal;
+  }
+  double u1 = rand_uniform();
+  double u2 = rand_uniform();
+  double n1;
+  BoxMuller(u1, u2, n1, _normal);
+  _has_normal = true;
+  return n1;
+}
+
+// every counter block gives two values, value pairs are assigned to blocks
+// by their position, so the numbers do not depend on how the work is split
+template <class Transform>
+void ParallelRandom::Fill(double *data, Index size, Transform transform) {
+  _engine.AlignToBlock();
+  const std::uint64_t start = _engine.getPosition();
+  const Philox4x32 engine = _engine;
+  const Index npairs = (size + 1) / 2;
+  constexpr Index pairs_per_chunk = 32768;
+  const Index nchunks = (npairs + pairs_per_chunk - 1) / pairs_per_chunk;
+  auto work = [&](Index chunk) {
+    Index first = chunk * pairs_per_chunk;
+    Index last = std::min(npairs, first + pairs_per_chunk);
+    for (Index pair = first; pair < last; ++pair) {
+      Philox4x32::Block block = engine.Generate(start + std::uint64_t(pair));
+      double a, b;
+      transform(ToDouble(block[0], block[1]), ToDouble(block[2], block[3]), a,
+                b);
+      data[2 * pair] = a;
+      if (2 * pair + 1 < size) {
+        data[2 * pair + 1] = b;
+      }
+    }
+  };
+  if (nchunks > 1) {
+    ThreadPool::Global().parallel_for(0, nchunks, work, 1);
+  } else if (nchunks == 1) {
+    work(0);
+  }
+  _engine.setPosition(start + std::uint64_t(npairs));
+}
+
+void ParallelRandom::FillUniform(double *data, Index size) {
+  Fill(data, size, [](double u1, double u2, double &a, double &b) {
+    a = u1;
+    b = u2;
+  });
+}
+
+void ParallelRandom::FillNormal(double *data, Index size) {
+  Fill(data, size, BoxMuller);
+}
+
+}  // namespace tools
+}  // namespace votca
@@ -31,6 +31,20 @@ RangeParser::RangeParser()
     //: _has_begin(false) , _has_end(false)
     = default;
 
+RangeParser::RangeParser(const RangeParser &rp) { *this = rp; }
+
+RangeParser &RangeParser::operator=(const RangeParser &rp) {
+  if (this == &rp) {
+    return *this;
+  }
+  // the source may be compiling its set in another thread
+  std::lock_guard<std::mutex> lock(rp._compile_mutex);
+  _blocks = rp._blocks;
+  _set = rp._set;
+  _compiled = rp._compiled.load();
+  return *this;
+}
+
 void RangeParser::Parse(std::string str) {
   // remove all spaces in string
   std::string::iterator it = std::remove_if(
@@ -41,29 +55,43 @@ void RangeParser::Parse(std::string str) {
   for (std::string bl : tok) {
     ParseBlock(bl);
   }
+  _compiled = false;
+}
+
+void RangeParser::Compile() const {
+  std::lock_guard<std::mutex> lock(_compile_mutex);
+  if (_compiled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::vector<RangeSet::Block> blocks;
+  blocks.reserve(_blocks.size());
+  for (const block_t &block : _blocks) {
+    blocks.push_back({block._begin, block._end, block._stride});
+  }
+  _set = RangeSet(blocks);
+  _compiled.store(true, std::memory_order_release);
 }
 
 void RangeParser::ParseBlock(std::string str) {
-  Tokenizer tokenizer(str, ":");
-  std::vector<std::string> toks;
+  std::vector<Index> toks;
 
   block_t block;
   block._stride = 1;
 
-  tokenizer.ToVector(toks);
+  TokenizerView(str, ":").ConvertToVector(toks);
   if (toks.size() > 3 || toks.size() < 1) {
     throw std::runtime_error("invalid range");
   }
 
-  block._begin = block._end = std::stoi(toks[0]);
+  block._begin = block._end = toks[0];
 
   if (toks.size() == 2) {
-    block._end = std::stoi(toks[1]);
+    block._end = toks[1];
   }
 
   if (toks.size() == 3) {
-    block._stride = std::stoi(toks[1]);
-    block._end = std::stoi(toks[2]);
+    block._stride = toks[1];
+    block._end = toks[2];
   }
 
   if (block._begin * block._stride > block._end * block._stride) {
@@ -0,0 +1,322 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+
+// Local VOTCA includes
+#include "votca/tools/rangeset.h"
+
+namespace votca {
+namespace tools {
+
+namespace {
+
+Index gcd(Index a, Index b) {
+  while (b != 0) {
+    Index t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+// smallest element of the block which is >= value
+Index FirstFrom(const RangeSet::Block &block, Index value) {
+  if (value <= block.begin) {
+    return block.begin;
+  }
+  return block.begin +
+         ((value - block.begin + block.stride - 1) / block.stride) *
+             block.stride;
+}
+
+// positive stride, begin <= end and end being the last element
+bool Normalize(RangeSet::Block &block) {
+  if (block.stride == 0) {
+    block.end = block.begin;
+    block.stride = 1;
+  } else if (block.stride < 0) {
+    block.stride = -block.stride;
+    if (block.begin < block.end) {
+      return false;
+    }
+    Index last =
+        block.begin - ((block.begin - block.end) / block.stride) * block.stride;
+    block.end = block.begin;
+    block.begin = last;
+  }
+  if (block.begin > block.end) {
+    return false;
+  }
+  block.end =
+      block.begin + ((block.end - block.begin) / block.stride) * block.stride;
+  if (block.begin == block.end) {
+    block.stride = 1;
+  }
+  return true;
+}
+
+// solves x = a.begin mod a.stride and x = b.begin mod b.stride
+bool IntersectBlocks(const RangeSet::Block &a, const RangeSet::Block &b,
+                     RangeSet::Block &result) {
+  Index g = gcd(a.stride, b.stride);
+  Index diff = b.begin - a.begin;
+  if (diff % g != 0) {
+    return false;
+  }
+  Index m = b.stride / g;
+  // modular inverse of a.stride / g modulo m by the extended euclid
+  Index old_r = (a.stride / g) % m, r = m;
+  Index old_s = 1, s = 0;
+  while (r != 0) {
+    Index q = old_r / r;
+    Index tmp = old_r - q * r;
+    old_r = r;
+    r = tmp;
+    tmp = old_s - q * s;
+    old_s = s;
+    s = tmp;
+  }
+  Index inverse = (m == 1) ? 0 : ((old_s % m) + m) % m;
+  Index k = ((((diff / g) % m + m) % m) * inverse) % m;
+  Index stride = a.stride * m;
+  Index x0 = a.begin + a.stride * k;
+
+  // first solution not smaller than both starts
+  Index offset = std::max(a.begin, b.begin) - x0;
+  Index t =
+      (offset >= 0) ? (offset + stride - 1) / stride : -(-offset / stride);
+  result.begin = x0 + t * stride;
+  result.end = std::min(a.end, b.end);
+  result.stride = stride;
+  return Normalize(result);
+}
+
+}  // namespace
+
+RangeSet::RangeSet(const std::vector<Block> &blocks) {
+  std::vector<Block> normalized;
+  normalized.reserve(blocks.size());
+  for (Block block : blocks) {
+    if (Normalize(block)) {
+      normalized.push_back(block);
+    }
+  }
+  if (normalized.empty()) {
+    return;
+  }
+
+  std::sort(normalized.begin(), normalized.end(),
+            [](const Block &a, const Block &b) { return a.begin < b.begin; });
+
+  // split the axis at every begin and behind every end, the blocks covering
+  // an elementary interval do not change inside of it
+  std::vector<Index> breaks;
+  breaks.reserve(2 * normalized.size());
+  for (const Block &block : normalized) {
+    breaks.push_back(block.begin);
+    breaks.push_back(block.end + 1);
+  }
+  std::sort(breaks.begin(), breaks.end());
+  breaks.erase(std::unique(breaks.begin(), breaks.end()), breaks.end());
+
+  std::vector<const Block *> active;
+  std::size_t next = 0;
+  for (std::size_t i = 0; i + 1 < breaks.size(); ++i) {
+    Index begin = breaks[i];
+    Index end = breaks[i + 1] - 1;
+    active.erase(std::remove_if(active.begin(), active.end(),
+                                [begin](const Block *b) {
+                                  return b->end < begin;
+                                }),
+                 active.end());
+    while (next < normalized.size() && normalized[next].begin == begin) {
+      active.push_back(&normalized[next]);
+      ++next;
+    }
+    if (active.empty()) {
+      continue;
+    }
+
+    Segment seg{begin, end, 1, {}};
+    bool contiguous = std::any_of(active.begin(), active.end(),
+                                  [](const Block *b) { return b->stride == 1; });
+    if (contiguous) {
+      seg.residues.push_back(0);
+    } else {
+      Index length = end - begin + 1;
+      Index period = 1;
+      for (const Block *b : active) {
+        period = period / gcd(period, b->stride) * b->stride;
+        if (period >= length) {
+          period = length;
+          break;
+        }
+      }
+      seg.period = period;
+      for (const Block *b : active) {
+        Index last = std::min(end, begin + period - 1);
+        for (Index x = FirstFrom(*b, begin); x <= last; x += b->stride) {
+          seg.residues.push_back(x - begin);
+        }
+      }
+      std::sort(seg.residues.begin(), seg.residues.end());
+      seg.residues.erase(std::unique(seg.residues.begin(), seg.residues.end()),
+                         seg.residues.end());
+    }
+
+    // continue the previous segment if the pattern just goes on
+    if (!_segments.empty()) {
+      Segment &prev = _segments.back();
+      if (prev.end + 1 == begin && prev.period == seg.period) {
+        Index shift = (begin - prev.begin) % prev.period;
+        std::vector<Index> shifted;
+        shifted.reserve(prev.residues.size());
+        for (Index r : prev.residues) {
+          shifted.push_back((r - shift + prev.period) % prev.period);
+        }
+        std::sort(shifted.begin(), shifted.end());
+        if (shifted == seg.residues) {
+          prev.end = end;
+          continue;
+        }
+      }
+    }
+    _segments.push_back(std::move(seg));
+  }
+
+  for (const Segment &seg : _segments) {
+    _size += CountSegment(seg);
+  }
+}
+
+Index RangeSet::CountSegment(const Segment &seg) {
+  Index length = seg.end - seg.begin + 1;
+  Index count = 0;
+  for (Index r : seg.residues) {
+    if (r < length) {
+      count += (length - 1 - r) / seg.period + 1;
+    }
+  }
+  return count;
+}
+
+bool RangeSet::contains(Index value) const {
+  auto it = std::upper_bound(
+      _segments.begin(), _segments.end(), value,
+      [](Index v, const Segment &seg) { return v < seg.begin; });
+  if (it == _segments.begin()) {
+    return false;
+  }
+  --it;
+  if (value > it->end) {
+    return false;
+  }
+  Index offset = (value - it->begin) % it->period;
+  return std::binary_search(it->residues.begin(), it->residues.end(), offset);
+}
+
+std::vector<RangeSet::Block> RangeSet::Blocks(const Segment &seg) {
+  std::vector<Block> result;
+  for (Index r : seg.residues) {
+    Block block{seg.begin + r, seg.end, seg.period};
+    if (Normalize(block)) {
+      result.push_back(block);
+    }
+  }
+  return result;
+}
+
+std::vector<RangeSet::Block> RangeSet::Blocks() const {
+  std::vector<Block> result;
+  for (const Segment &seg : _segments) {
+    std::vector<Block> blocks = Blocks(seg);
+    result.insert(result.end(), blocks.begin(), blocks.end());
+  }
+  return result;
+}
+
+RangeSet RangeSet::Union(const RangeSet &other) const {
+  std::vector<Block> blocks = Blocks();
+  std::vector<Block> other_blocks = other.Blocks();
+  blocks.insert(blocks.end(), other_blocks.begin(), other_blocks.end());
+  return RangeSet(blocks);
+}
+
+RangeSet RangeSet::Intersect(const RangeSet &other) const {
+  std::vector<Block> blocks;
+  auto a = _segments.begin();
+  auto b = other._segments.begin();
+  while (a != _segments.end() && b != other._segments.end()) {
+    if (a->end < b->begin) {
+      ++a;
+    } else if (b->end < a->begin) {
+      ++b;
+    } else {
+      for (const Block &block_a : Blocks(*a)) {
+        for (const Block &block_b : Blocks(*b)) {
+          Block result;
+          if (IntersectBlocks(block_a, block_b, result)) {
+            blocks.push_back(result);
+          }
+        }
+      }
+      if (a->end < b->end) {
+        ++a;
+      } else {
+        ++b;
+      }
+    }
+  }
+  return RangeSet(blocks);
+}
+
+std::vector<Index> RangeSet::ToVector() const {
+  std::vector<Index> result;
+  result.reserve(_size);
+  for (const Segment &seg : _segments) {
+    for (Index base = seg.begin; base <= seg.end; base += seg.period) {
+      for (Index r : seg.residues) {
+        if (base + r > seg.end) {
+          break;
+        }
+        result.push_back(base + r);
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<bool> RangeSet::ToMask(Index n) const {
+  std::vector<bool> mask(n, false);
+  for (const Segment &seg : _segments) {
+    if (seg.begin >= n) {
+      break;
+    }
+    for (const Block &block : Blocks(seg)) {
+      for (Index x = FirstFrom(block, 0); x <= std::min(block.end, n - 1);
+           x += block.stride) {
+        mask[x] = true;
+      }
+    }
+  }
+  return mask;
+}
+
+}  // namespace tools
+}  // namespace votca
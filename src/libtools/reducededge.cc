@@ -20,6 +20,7 @@
 // Standard includes
 #include <algorithm>
 #include <cassert>
+#include <utility>
 
 // Local VOTCA includes
 #include "votca/tools/reducededge.h"
@@ -110,7 +111,8 @@ ReducedEdge::ReducedEdge(vector<Index> vertices) {
   if (verticesShouldBeReversed_(vertices)) {
     reverse(vertices.begin(), vertices.end());
   }
-  vertices_ = vertices;
+  edge_ = Edge(vertices.front(), vertices.back());
+  vertices_ = std::move(vertices);
 }
 
 vector<Edge> ReducedEdge::expand() const {
@@ -21,7 +21,11 @@
 #include <algorithm>
 #include <cassert>
 
+// Third party includes
+#include <boost/functional/hash.hpp>
+
 // Local VOTCA includes
+#include "votca/tools/cyclebasis.h"
 #include "votca/tools/edge.h"
 #include "votca/tools/reducedgraph.h"
 
@@ -37,31 +41,10 @@ class GraphNode;
  ******************************************************************************/
 
 /**
- * \brief Function will compare a chain with a vector of chains
- *
- * If the one of the chains in the vector of chains is equivalent will return
- * true. A chain is simply a vector of integers where each integer represents
- * a vertex along an edge. The vertices appear in the chain in the same order
- * as they exist in a graph.
+ * \brief hash of a chain of vertices, used to find duplicate chains
  **/
-bool compareChainWithChains_(const vector<Index>& chain,
-                             const vector<vector<Index>>& chains) {
-  bool match = false;
-  for (const vector<Index>& chain2 : chains) {
-    if (chain2.size() == chain.size()) {
-      match = true;
-      for (size_t index = 0; index < chain.size(); ++index) {
-        if (chain2.at(index) != chain.at(index)) {
-          match = false;
-          break;
-        }
-      }  // Cycle vertices in each chain
-      if (match) {
-        return true;
-      }
-    }  // Chains same size
-  }
-  return false;
+size_t hashChain_(const vector<Index>& chain) {
+  return boost::hash_range(chain.begin(), chain.end());
 }
 
 /**
@@ -96,7 +79,7 @@ bool compareChainWithChains_(const vector<Index>& chain,
  **/
 set<Index> getVertexJunctions_(const vector<ReducedEdge>& reduced_edges) {
   unordered_map<Index, Index> vertex_count;
-  for (ReducedEdge reduced_edge : reduced_edges) {
+  for (const ReducedEdge& reduced_edge : reduced_edges) {
     // if loop, increment value is double and the first index is skipped to
     // prevent over counting of the first number
     Index increment = 1;
@@ -105,7 +88,7 @@ set<Index> getVertexJunctions_(const vector<ReducedEdge>& reduced_edges) {
       ++index;
       increment = 2;
     }
-    vector<Index> chain = reduced_edge.getChain();
+    const vector<Index>& chain = reduced_edge.getChain();
     for (; index < chain.size(); ++index) {
       if (vertex_count.count(chain.at(index))) {
         vertex_count[chain.at(index)] += increment;
@@ -123,51 +106,6 @@ set<Index> getVertexJunctions_(const vector<ReducedEdge>& reduced_edges) {
   return junctions;
 }
 
-/**
- * \breif function adds an edge to an unordered_map and a vector if it is found
- * to not be a loop
- *
- * A loop is an edge that essentially makes a circle. In an edge that is a loop
- * will have both end points equal to the samve vertex. E.g. a reduced edge
- * like this:
- *
- * Edge  Expanded edge (chain of vertices)
- * 2, 2 : 2 - 4 - 3 - 5 - 2
- *
- * Graph
- *
- *  2 - 4
- *  |   |
- *  5 - 3
- *
- * Reduced Graph
- *
- *  - 2
- *  |_|
- *
- * @param[in,out] - vector of edges, an edge is added to the vector if it is not
- * a loop
- * @param[in] - a reduced edge, the edge to be added
- * @param[in,out] - an unordered_map that stores the edge and its chain if it
- * is found to not be a loop
- **/
-void addEdgeIfNotLoop_(
-    vector<Edge>& edges, const ReducedEdge reduced_edge,
-    unordered_map<Edge, vector<vector<Index>>>& expanded_edges) {
-
-  Edge edge(reduced_edge.getEndPoint1(), reduced_edge.getEndPoint2());
-  if (expanded_edges.count(edge)) {
-    bool match =
-        compareChainWithChains_(reduced_edge.getChain(), expanded_edges[edge]);
-    if (!match) {
-      expanded_edges[edge].push_back(reduced_edge.getChain());
-    }
-  } else {
-    expanded_edges[edge].push_back(reduced_edge.getChain());
-  }
-  edges.push_back(edge);
-}
-
 /**
  * \brief This is a helper function used to help store the vertex chain in a
  * reproducable order
@@ -209,14 +147,17 @@ void orderChainAfterInitialVertex_(vector<Index>& chain) {
   }
 }
 
-bool reorderAndStoreChainIfDoesNotExist_(
-    vector<Edge>& edges,
-    unordered_map<Edge, vector<vector<Index>>>& expanded_edges,
-    vector<Index> chain, Index vertex, size_t& chain_index) {
-
-  Edge edge(vertex, vertex);
-  edges.push_back(edge);
+/**
+ * \brief Rotates the chain of a loop so that it starts and ends at vertex
+ *
+ * @param[in] - chain of the loop
+ * @param[in,out] - position of vertex in the chain
+ * @return - the rotated chain in reproducable order
+ **/
+vector<Index> rotateChainToVertex_(const vector<Index>& chain,
+                                   size_t& chain_index) {
   vector<Index> new_chain;
+  new_chain.reserve(chain.size());
   for (size_t index = 0; index < chain.size(); ++index) {
     if (((chain_index + index) % chain.size()) == 0) {
       ++chain_index;
@@ -227,18 +168,13 @@ bool reorderAndStoreChainIfDoesNotExist_(
   // Ensure that the new_chain is sorted so after the first vertex they are
   // ordered from smallest to largest
   orderChainAfterInitialVertex_(new_chain);
-  bool match = compareChainWithChains_(new_chain, expanded_edges[edge]);
-  if (!match) {
-    expanded_edges[edge].push_back(new_chain);
-    return true;
-  }
-  return false;
+  return new_chain;
 }
 
 set<Index> getAllVertices_(const std::vector<ReducedEdge>& reduced_edges) {
   set<Index> vertices;
   for (const ReducedEdge& reduced_edge : reduced_edges) {
-    vector<Index> chain = reduced_edge.getChain();
+    const vector<Index>& chain = reduced_edge.getChain();
     for (const Index vertex : chain) {
       vertices.insert(vertex);
     }
@@ -246,54 +182,72 @@ set<Index> getAllVertices_(const std::vector<ReducedEdge>& reduced_edges) {
   return vertices;
 }
 
-set<Index> getAllConnectedVertices_(
-    const unordered_map<Edge, vector<vector<Index>>>& expanded_edges) {
-  set<Index> all_vertices;
+/******************************************************************************
+ * Private Class Methods
+ ******************************************************************************/
 
-  for (const auto& edge_and_chains : expanded_edges) {
-    for (vector<Index> chain : edge_and_chains.second) {
-      all_vertices.insert(chain.begin(), chain.end());
+bool ReducedGraph::addChainIfNew_(
+    const Edge& edge, const vector<Index>& chain,
+    unordered_multimap<size_t, Index>& chain_hashes) {
+  size_t hash = hashChain_(chain);
+  auto range = chain_hashes.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    Index id = it->second;
+    if (std::equal(chain_vertices_.begin() + chain_offsets_[id],
+                   chain_vertices_.begin() + chain_offsets_[id + 1],
+                   chain.begin(), chain.end())) {
+      return false;
     }
   }
-  return all_vertices;
+  Index id = Index(chain_offsets_.size()) - 1;
+  chain_vertices_.insert(chain_vertices_.end(), chain.begin(), chain.end());
+  chain_offsets_.push_back(Index(chain_vertices_.size()));
+  chain_hashes.emplace(hash, id);
+  edge_chains_[edge].push_back(id);
+  return true;
 }
-/******************************************************************************
- * Private Class Methods
- ******************************************************************************/
 
 void ReducedGraph::init_(vector<ReducedEdge> reduced_edges,
                          unordered_map<Index, GraphNode> nodes) {
   vector<Edge> edges;
+  edges.reserve(reduced_edges.size());
   nodes_ = nodes;
 
   junctions_ = getVertexJunctions_(reduced_edges);
 
-  for (const ReducedEdge& reduced_edge : reduced_edges) {
+  // identical chains have the same hash, so each chain is only compared
+  // with the few chains sharing its hash
+  unordered_multimap<size_t, Index> chain_hashes;
+  chain_hashes.reserve(reduced_edges.size());
 
+  for (const ReducedEdge& reduced_edge : reduced_edges) {
+    const vector<Index>& chain = reduced_edge.getChain();
+    bool edge_added = false;
     if (reduced_edge.loop() &&
         junctions_.count(reduced_edge.getEndPoint1()) == 0) {
-      vector<Index> chain = reduced_edge.getChain();
       size_t chain_index = 0;
-      bool edge_added = false;
       for (Index vertex : chain) {
         if (junctions_.count(vertex)) {
-          edge_added = reorderAndStoreChainIfDoesNotExist_(
-              edges, expanded_edges_, chain, vertex, chain_index);
+          Edge edge(vertex, vertex);
+          edges.push_back(edge);
+          edge_added = addChainIfNew_(
+              edge, rotateChainToVertex_(chain, chain_index), chain_hashes);
           break;
         }
         ++chain_index;
       }
-      if (!edge_added) {
-        addEdgeIfNotLoop_(edges, reduced_edge, expanded_edges_);
-      }
-    } else {
-      addEdgeIfNotLoop_(edges, reduced_edge, expanded_edges_);
+    }
+    if (!edge_added) {
+      Edge edge(reduced_edge.getEndPoint1(), reduced_edge.getEndPoint2());
+      addChainIfNew_(edge, chain, chain_hashes);
+      edges.push_back(edge);
     }
   }
 
   edge_container_ = EdgeContainer(edges);
+  rings_outdated_ = true;
 
-  calcId_();
+  invalidateId_();
 }
 
 /******************************************************************************
@@ -337,27 +291,37 @@ ReducedGraph::ReducedGraph(std::vector<ReducedEdge> reduced_edges,
 
 Graph ReducedGraph::expandGraph() const {
   vector<Edge> all_expanded_edges;
-  for (const pair<Edge, vector<vector<Index>>> edge_and_vertices :
-       expanded_edges_) {
-    vector<vector<Edge>> edges_local = expandEdge(edge_and_vertices.first);
-    for (vector<Edge>& edges : edges_local) {
-      all_expanded_edges.insert(all_expanded_edges.end(), edges.begin(),
-                                edges.end());
+  all_expanded_edges.reserve(chain_vertices_.size());
+  for (const pair<const Edge, vector<Index>>& edge_and_chains : edge_chains_) {
+    for (Index id : edge_and_chains.second) {
+      for (Index index = chain_offsets_[id]; index < chain_offsets_[id + 1] - 1;
+           ++index) {
+        all_expanded_edges.emplace_back(chain_vertices_[index],
+                                        chain_vertices_[index + 1]);
+      }
     }
   }
   return Graph(all_expanded_edges, nodes_);
 }
 
+vector<vector<Index>> ReducedGraph::calcRings_() const {
+  // the search of the cycle basis only starts at the junctions, which are
+  // the vertices of the reduced graph, so the chains add little to the cost
+  return findMinimumCycleBasis(expandGraph());
+}
+
 vector<vector<Edge>> ReducedGraph::expandEdge(const Edge& edge) const {
   vector<vector<Edge>> all_edges;
-  vector<vector<Index>> chains = expanded_edges_.at(edge);
-  for (vector<Index> vertices : chains) {
+  const vector<Index>& chains = edge_chains_.at(edge);
+  all_edges.reserve(chains.size());
+  for (Index id : chains) {
     vector<Edge> edges;
-    for (size_t index = 0; index < (vertices.size() - 1); ++index) {
-      Edge edge_temp(vertices.at(index), vertices.at(index + 1));
-      edges.push_back(edge_temp);
+    edges.reserve(chain_offsets_[id + 1] - chain_offsets_[id] - 1);
+    for (Index index = chain_offsets_[id]; index < chain_offsets_[id + 1] - 1;
+         ++index) {
+      edges.emplace_back(chain_vertices_[index], chain_vertices_[index + 1]);
     }
-    all_edges.push_back(edges);
+    all_edges.push_back(std::move(edges));
   }
   return all_edges;
 }
@@ -370,7 +334,8 @@ vector<pair<Index, GraphNode>> ReducedGraph::getNodes() const {
     nodes.push_back(id_and_node);
   }
 
-  set<Index> all_connected_vertices = getAllConnectedVertices_(expanded_edges_);
+  set<Index> all_connected_vertices(chain_vertices_.begin(),
+                                    chain_vertices_.end());
   // Grab the nodes that are not attached to any edges
   for (pair<Index, GraphNode> id_and_node : nodes_) {
     if (!all_connected_vertices.count(id_and_node.first)) {
@@ -382,8 +347,8 @@ vector<pair<Index, GraphNode>> ReducedGraph::getNodes() const {
 
 vector<Index> ReducedGraph::getVerticesDegree(Index degree) const {
   if (degree == 0) {
-    set<Index> all_connected_vertices =
-        getAllConnectedVertices_(expanded_edges_);
+    set<Index> all_connected_vertices(chain_vertices_.begin(),
+                                      chain_vertices_.end());
     vector<Index> vertices;
     for (const pair<Index, GraphNode> id_and_node : nodes_) {
       if (all_connected_vertices.count(id_and_node.first) == false) {
@@ -408,11 +373,12 @@ ostream& operator<<(ostream& os, const ReducedGraph graph) {
   os << endl;
   os << "Expanded Edge Chains" << endl;
 
-  for (const pair<const Edge, vector<vector<Index>>>& edge_and_chains :
-       graph.expanded_edges_) {
-    for (const vector<Index>& chain : edge_and_chains.second) {
-      for (const Index vertex : chain) {
-        os << vertex << " ";
+  for (const pair<const Edge, vector<Index>>& edge_and_chains :
+       graph.edge_chains_) {
+    for (Index id : edge_and_chains.second) {
+      for (Index index = graph.chain_offsets_[id];
+           index < graph.chain_offsets_[id + 1]; ++index) {
+        os << graph.chain_vertices_[index] << " ";
       }
       os << endl;
     }
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <algorithm>
+#include <thread>
+
+// Local VOTCA includes
+#include "votca/tools/synchronization.h"
+
+namespace votca {
+namespace tools {
+
+constexpr Index HybridLock::spin_iterations;
+
+void HybridLock::lock() {
+  for (Index i = 0; i < spin_iterations; i++) {
+    if (try_lock()) {
+      return;
+    }
+    if (i % 64 == 63) {
+      std::this_thread::yield();
+    }
+  }
+  std::unique_lock<std::mutex> guard(_mutex);
+  _sleepers++;
+  _wakeup.wait(guard, [this]() { return !_locked.exchange(true); });
+  _sleepers--;
+}
+
+void HybridLock::unlock() {
+  // sequentially consistent, so either we see the sleeper or it sees the
+  // free lock
+  _locked.store(false);
+  if (_sleepers.load() > 0) {
+    // taking the mutex makes sure the sleeper is waiting and gets the signal
+    { std::lock_guard<std::mutex> guard(_mutex); }
+    _wakeup.notify_one();
+  }
+}
+
+Index ThreadShard(Index nshards) {
+  static std::atomic<Index> next_thread{0};
+  thread_local Index thread_id = next_thread++;
+  return thread_id % nshards;
+}
+
+ShardedCounter::ShardedCounter(Index nshards) : _shards(nshards) {}
+
+Index ShardedCounter::value() const {
+  Index sum = 0;
+  for (const Shard& shard : _shards) {
+    sum += shard.value.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+void ShardedCounter::reset() {
+  for (Shard& shard : _shards) {
+    shard.value.store(0, std::memory_order_relaxed);
+  }
+}
+
+Index ShardedCounter::DefaultShards() {
+  return 2 * std::max(Index(1), Index(std::thread::hardware_concurrency()));
+}
+
+}  // namespace tools
+}  // namespace votca
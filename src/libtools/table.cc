@@ -26,6 +26,7 @@
 
 // Local VOTCA includes
 #include "votca/tools/lexical_cast.h"
+#include "votca/tools/profiler.h"
 #include "votca/tools/table.h"
 #include "votca/tools/tokenizer.h"
 
@@ -45,6 +46,7 @@ void Table::resize(Index N) {
 }
 
 void Table::Load(string filename) {
+  VOTCA_PROFILE_REGION("Table::Load");
   ifstream in;
   in.open(filename);
   if (!in) {
@@ -57,6 +59,7 @@ void Table::Load(string filename) {
 }
 
 void Table::Save(string filename) const {
+  VOTCA_PROFILE_REGION("Table::Save");
   ofstream out;
   out.open(filename);
   if (!out) {
@@ -96,6 +99,7 @@ istream &operator>>(istream &in, Table &t) {
   bool bHasN = false;
   string line;
   Index line_number = 0;
+  std::vector<boost::string_ref> tokens;
   t.clear();
 
   // read till the first data line
@@ -108,10 +112,9 @@ istream &operator>>(istream &in, Table &t) {
     line = line.substr(0, line.find("#"));
     line = line.substr(0, line.find("@"));
 
-    // tokenize string and put it to vector
-    Tokenizer tok(line, " \t");
-
-    vector<string> tokens = tok.ToVector();
+    // tokenize string, the tokens point into line
+    tokens.clear();
+    TokenizerView(line, " \t\r").ToVector(tokens);
 
     // skip empty lines
     if (tokens.size() == 0) {
@@ -124,14 +127,16 @@ istream &operator>>(istream &in, Table &t) {
       bHasN = true;
     } else if (tokens.size() == 2) {
       // it's the first data line with 2 or 3 entries
-      t.push_back(std::stod(tokens[0]), std::stod(tokens[1]), 'i');
+      t.push_back(ConvertToken<double>(tokens[0]),
+                  ConvertToken<double>(tokens[1]), 'i');
     } else if (tokens.size() > 2) {
       char flag = 'i';
-      string sflag = tokens.back();
+      boost::string_ref sflag = tokens.back();
       if (sflag == "i" || sflag == "o" || sflag == "u") {
         flag = sflag[0];
       }
-      t.push_back(std::stod(tokens[0]), std::stod(tokens[1]), flag);
+      t.push_back(ConvertToken<double>(tokens[0]),
+                  ConvertToken<double>(tokens[1]), flag);
     } else {
       throw runtime_error("error, wrong table format");
     }
@@ -147,10 +152,9 @@ istream &operator>>(istream &in, Table &t) {
     line = line.substr(0, line.find("#"));
     line = line.substr(0, line.find("@"));
 
-    // tokenize string and put it to vector
-    Tokenizer tok(line, " \t");
-    vector<string> tokens;
-    tok.ToVector(tokens);
+    // tokenize string, the tokens point into line
+    tokens.clear();
+    TokenizerView(line, " \t\r").ToVector(tokens);
 
     // skip empty lines
     if (tokens.size() == 0) {
@@ -159,13 +163,15 @@ istream &operator>>(istream &in, Table &t) {
 
     // it's a data line
     if (tokens.size() == 2) {
-      t.push_back(std::stod(tokens[0]), std::stod(tokens[1]), 'i');
+      t.push_back(ConvertToken<double>(tokens[0]),
+                  ConvertToken<double>(tokens[1]), 'i');
     } else if (tokens.size() > 2) {
       char flag = 'i';
       if (tokens[2] == "i" || tokens[2] == "o" || tokens[2] == "u") {
         flag = tokens[2][0];
       }
-      t.push_back(std::stod(tokens[0]), std::stod(tokens[1]), flag);
+      t.push_back(ConvertToken<double>(tokens[0]),
+                  ConvertToken<double>(tokens[1]), flag);
     } else {
       // otherwise error
       throw runtime_error("error, wrong table format");
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Standard includes
+#include <stdexcept>
+
+// Local VOTCA includes
+#include "votca/tools/threadpool.h"
+
+namespace votca {
+namespace tools {
+
+namespace {
+// pool and index of the worker running on this thread
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local Index current_worker = 0;
+}  // namespace
+
+ThreadPool::ThreadPool(Index nthreads) { start(nthreads); }
+
+ThreadPool::~ThreadPool() { stop(); }
+
+void ThreadPool::Resize(Index nthreads) {
+  if (nthreads == size()) {
+    return;
+  }
+  if (current_pool == this) {
+    throw std::runtime_error("ThreadPool cannot be resized from its own tasks");
+  }
+  stop();
+  start(nthreads);
+}
+
+Index ThreadPool::WorkerIndex() const {
+  return (current_pool == this) ? current_worker : 0;
+}
+
+ThreadPool& ThreadPool::Global() {
+  static ThreadPool pool(Index(std::thread::hardware_concurrency()));
+  return pool;
+}
+
+void ThreadPool::start(Index nthreads) {
+  _stop = false;
+  Index nworkers = std::max(Index(1), nthreads) - 1;
+  _queues.clear();
+  for (Index i = 0; i <= nworkers; i++) {
+    _queues.push_back(std::make_unique<Queue>());
+  }
+  for (Index i = 1; i <= nworkers; i++) {
+    _workers.emplace_back(&ThreadPool::work, this, i);
+  }
+}
+
+void ThreadPool::stop() {
+  {
+    std::lock_guard<std::mutex> lock(_sleep_mutex);
+    _stop = true;
+  }
+  _wakeup.notify_all();
+  for (std::thread& worker : _workers) {
+    worker.join();
+  }
+  _workers.clear();
+}
+
+void ThreadPool::push(std::function<void()> task) {
+  Index queue = WorkerIndex();
+  if (queue == 0) {
+    queue = Index(_next_queue++ % _queues.size());
+  }
+  {
+    std::lock_guard<std::mutex> lock(_queues[queue]->mutex);
+    _queues[queue]->tasks.push_back(std::move(task));
+  }
+  {
+    // taking the lock makes sure a worker about to sleep sees the new task
+    std::lock_guard<std::mutex> lock(_sleep_mutex);
+    _pending++;
+  }
+  _wakeup.notify_one();
+}
+
+bool ThreadPool::pop(Index worker, std::function<void()>& task) {
+  // own queue first, newest task is most likely still in cache
+  {
+    Queue& own = *_queues[worker];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      _pending--;
+      return true;
+    }
+  }
+  // steal the oldest task from the others
+  Index nqueues = Index(_queues.size());
+  for (Index i = 1; i < nqueues; i++) {
+    Queue& other = *_queues[(worker + i) % nqueues];
+    std::lock_guard<std::mutex> lock(other.mutex);
+    if (!other.tasks.empty()) {
+      task = std::move(other.tasks.front());
+      other.tasks.pop_front();
+      _pending--;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::work(Index worker) {
+  current_pool = this;
+  current_worker = worker;
+  std::function<void()> task;
+  while (true) {
+    if (pop(worker, task)) {
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(_sleep_mutex);
+    _wakeup.wait(lock, [this]() { return _stop || _pending > 0; });
+    if (_stop && _pending == 0) {
+      return;
+    }
+  }
+}
+
+}  // namespace tools
+}  // namespace votca
@@ -21,6 +21,14 @@
 namespace votca {
 namespace tools {
 
+SeparatorSet MakeSeparatorSet(const char *separators) {
+  SeparatorSet result;
+  for (; *separators; ++separators) {
+    result.set(static_cast<unsigned char>(*separators));
+  }
+  return result;
+}
+
 int wildcmp(const std::string &wild, const std::string &string) {
   return wildcmp(wild.c_str(), string.c_str());
 }
@@ -0,0 +1,8 @@
+%%MatrixMarket matrix coordinate real symmetric
+% 4x4 symmetric sparse matrix, lower triangle
+4 4 5
+1 1 1.5
+2 1 -2.0
+3 3 3.0
+4 2 4.25
+4 4 -1.0
@@ -21,6 +21,8 @@
 
 // Standard includes
 #include <fstream>
+#include <set>
+#include <thread>
 
 // Third party includes
 #include <boost/filesystem.hpp>
@@ -115,6 +117,72 @@ BOOST_AUTO_TEST_CASE(load_defaults_test) {
   test_calc.Initialize(user_options);
 }
 
+BOOST_AUTO_TEST_CASE(load_options_test) {
+
+  struct TestOptions {
+    std::string option0;
+    Index option1;
+    double option2;
+    std::string option71;
+  };
+
+  class TestOptionsCalc : public tools::Calculator {
+
+   public:
+    TestOptions opt;
+
+    std::string Identify() override { return "testoptionscalc"; }
+
+    void Initialize(const tools::Property &user_options) override {
+
+      // Create folder for test
+      const char dir_path[] = "calculators";
+      boost::filesystem::path dir(dir_path);
+      boost::filesystem::create_directory(dir);
+      dir.append("xml");
+      boost::filesystem::create_directory(dir);
+
+      std::ofstream defaults("calculators/xml/testoptionscalc.xml");
+      defaults
+          << "<options>\n"
+          << "<testoptionscalc>\n"
+          << "<option0 default=\"foo\" choices=\"foo,bar\"></option0>\n"
+          << "<option1 default=\"0\" choices=\"int+\"></option1>\n"
+          << "<option2 default=\"-3.141592\" choices=\"float\"></option2>\n"
+          << "<option7>\n"
+          << "<option71 default=\"none\" choices=\"some,none\"></option71>\n"
+          << "</option7>\n"
+          << "</testoptionscalc>\n"
+          << "</options>";
+      defaults.close();
+
+      tools::OptionsBinder<TestOptions> binder;
+      binder.Bind("option0", &TestOptions::option0)
+          .Bind("option1", &TestOptions::option1)
+          .Bind("option2", &TestOptions::option2)
+          .Bind("option7.option71", &TestOptions::option71);
+      opt = LoadOptions("calculators", user_options, binder);
+    }
+  };
+
+  setenv("VOTCASHARE", ".", 1);
+
+  tools::Property user_options;
+  tools::Property &opt = user_options.add("options", "");
+  tools::Property &opt_test = opt.add("testoptionscalc", "");
+  opt_test.add("option1", "42");
+
+  TestOptionsCalc calc;
+  calc.Initialize(user_options);
+  BOOST_CHECK_EQUAL(calc.opt.option0, "foo");
+  BOOST_CHECK_EQUAL(calc.opt.option1, 42);
+  BOOST_CHECK_CLOSE(calc.opt.option2, -3.141592, 0.00001);
+  BOOST_CHECK_EQUAL(calc.opt.option71, "none");
+
+  opt_test.get("option1").value() = "-1";
+  BOOST_CHECK_THROW(calc.Initialize(user_options), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_choices) {
 
   class TestChoices : public tools::Calculator {
@@ -177,4 +245,26 @@ BOOST_AUTO_TEST_CASE(test_choices) {
   BOOST_CHECK_THROW(test7.Initialize(user_options), std::runtime_error);
 }
 
+BOOST_AUTO_TEST_CASE(nthreads_test) {
+
+  class ThreadCalc : public tools::Calculator {
+   public:
+    std::string Identify() override { return "threadcalc"; }
+    void Initialize(const tools::Property &) override {}
+  };
+
+  Index pool_size = tools::ThreadPool::Global().size();
+  ThreadCalc calc;
+  calc.setnThreads(1);
+  // the shared pool keeps its size
+  BOOST_CHECK_EQUAL(tools::ThreadPool::Global().size(), pool_size);
+
+  std::set<std::thread::id> threads;
+  calc.parallel_for(0, 1000, [&](Index) {
+    threads.insert(std::this_thread::get_id());
+  });
+  BOOST_CHECK_EQUAL(threads.size(), 1);
+  BOOST_CHECK(threads.count(std::this_thread::get_id()) == 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,118 @@
+/*
+ *            Copyright 2009-2020 The VOTCA Development Team
+ *                       (http://www.votca.org)
+ *
+ *      Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * You may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *              http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE connectedcomponents_test
+
+// Standard includes
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/connectedcomponents.h"
+#include "votca/tools/graph.h"
+#include "votca/tools/graphnode.h"
+
+using namespace std;
+using namespace votca::tools;
+
+BOOST_AUTO_TEST_SUITE(connectedcomponents_test)
+
+BOOST_AUTO_TEST_CASE(graph_test) {
+
+  //  1 - 2 - 3
+  //      |   |            8 - 9 - 10      11
+  //      4 - 5 - 6 -7
+
+  vector<Edge> edges{Edge(1, 2), Edge(2, 3), Edge(2, 4), Edge(4, 5),
+                     Edge(3, 5), Edge(5, 6), Edge(6, 7), Edge(8, 9),
+                     Edge(9, 10)};
+  unordered_map<votca::Index, GraphNode> nodes;
+  for (votca::Index index = 1; index < 12; ++index) {
+    nodes[index] = GraphNode({{"a", index}}, {}, {});
+  }
+  Graph graph(edges, nodes);
+
+  ConnectedComponents components(graph);
+  BOOST_REQUIRE_EQUAL(components.size(), 3);
+  BOOST_CHECK_EQUAL(components.getComponent(1), 0);
+  BOOST_CHECK_EQUAL(components.getComponent(7), 0);
+  BOOST_CHECK_EQUAL(components.getComponent(10), 1);
+  BOOST_CHECK_EQUAL(components.getComponent(11), 2);
+  BOOST_CHECK_THROW(components.getComponent(12), runtime_error);
+  BOOST_CHECK_THROW(components.getSubGraph(3), runtime_error);
+
+  SubGraphView view = components.getSubGraph(1);
+  BOOST_CHECK_EQUAL(view.size(), 3);
+  vector<votca::Index> vertices(view.getVertices().begin(),
+                                view.getVertices().end());
+  BOOST_CHECK(vertices == vector<votca::Index>({8, 9, 10}));
+  BOOST_CHECK_EQUAL(view.getEdges().size(), 2);
+  BOOST_CHECK_EQUAL(components.getSubGraph(0).getEdges().size(), 7);
+  BOOST_CHECK_EQUAL(components.getSubGraph(2).getEdges().size(), 0);
+
+  Graph sub_graph = view.toGraph(graph);
+  BOOST_CHECK_EQUAL(sub_graph.getVertices().size(), 3);
+  BOOST_CHECK(sub_graph.edgeExist(Edge(9, 10)));
+  BOOST_CHECK_EQUAL(sub_graph.getNode(9).getInt("a"), 9);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_test) {
+  // many small chains, large enough for the parallel pass
+  std::mt19937 rng(7);
+  votca::Index nvertices = 200000;
+  votca::Index chain_length = 5;
+  vector<votca::Index> vertices;
+  for (votca::Index i = 0; i < nvertices; ++i) {
+    vertices.push_back(3 * i);
+  }
+  vector<votca::Index> order = vertices;
+  std::shuffle(order.begin(), order.end(), rng);
+  vector<Edge> edges;
+  for (votca::Index i = 0; i < nvertices; ++i) {
+    if (i % chain_length != 0) {
+      edges.push_back(Edge(order[i - 1], order[i]));
+    }
+  }
+  std::shuffle(edges.begin(), edges.end(), rng);
+
+  ConnectedComponents parallel(vertices, edges, true);
+  ConnectedComponents serial(vertices, edges, false);
+  BOOST_CHECK_EQUAL(parallel.size(), nvertices / chain_length);
+  BOOST_CHECK(parallel.getComponentIds() == serial.getComponentIds());
+  for (votca::Index i = 0; i < nvertices; i += chain_length) {
+    BOOST_CHECK_EQUAL(parallel.getComponent(order[i]),
+                      parallel.getComponent(order[i + chain_length - 1]));
+  }
+  votca::Index total_edges = 0;
+  for (votca::Index c = 0; c < parallel.size(); ++c) {
+    total_edges += votca::Index(parallel.getSubGraph(c).getEdges().size());
+    BOOST_CHECK_EQUAL(parallel.getSubGraph(c).size(), chain_length);
+  }
+  BOOST_CHECK_EQUAL(total_edges, votca::Index(edges.size()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,157 @@
+/*
+ *            Copyright 2009-2020 The VOTCA Development Team
+ *                       (http://www.votca.org)
+ *
+ *      Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * You may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *              http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE cyclebasis_test
+
+// Standard includes
+#include <unordered_map>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/cyclebasis.h"
+#include "votca/tools/graph.h"
+#include "votca/tools/graphalgorithm.h"
+#include "votca/tools/graphnode.h"
+#include "votca/tools/reducedgraph.h"
+
+using namespace std;
+using namespace votca::tools;
+
+namespace {
+Graph makeGraph(const vector<Edge>& edges) {
+  unordered_map<votca::Index, GraphNode> nodes;
+  for (const Edge& edge : edges) {
+    nodes[edge.getEndPoint1()] = GraphNode();
+    nodes[edge.getEndPoint2()] = GraphNode();
+  }
+  return Graph(edges, nodes);
+}
+
+using Rings = vector<vector<votca::Index>>;
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(cyclebasis_test)
+
+BOOST_AUTO_TEST_CASE(tree_test) {
+  // 0 - 1 - 2
+  //     |
+  //     3
+  Graph graph = makeGraph({Edge(0, 1), Edge(1, 2), Edge(1, 3)});
+  BOOST_CHECK(findMinimumCycleBasis(graph).empty());
+  BOOST_CHECK(graph.getRings().empty());
+}
+
+BOOST_AUTO_TEST_CASE(single_ring_test) {
+  // 7 - 4 - 5
+  //     |   |
+  //     3 - 9 - 1
+  Graph graph = makeGraph(
+      {Edge(7, 4), Edge(4, 5), Edge(5, 9), Edge(9, 3), Edge(3, 4), Edge(9, 1)});
+  Rings rings = findMinimumCycleBasis(graph);
+  BOOST_CHECK(rings == Rings({{3, 4, 5, 9}}));
+}
+
+BOOST_AUTO_TEST_CASE(fused_rings_test) {
+  // 0 - 1 - 2
+  // |   |   |
+  // 3 - 4 - 5
+  Graph graph = makeGraph({Edge(0, 1), Edge(1, 2), Edge(0, 3), Edge(1, 4),
+                           Edge(2, 5), Edge(3, 4), Edge(4, 5)});
+  Rings rings = graph.getRings();
+  BOOST_CHECK(rings == Rings({{0, 1, 4, 3}, {1, 2, 5, 4}}));
+  // the cached rings are returned on the second call
+  BOOST_CHECK(&graph.getRings() == &graph.getRings());
+}
+
+BOOST_AUTO_TEST_CASE(cube_test) {
+  // a cube has six four membered rings of which five are independent
+  vector<Edge> edges;
+  for (votca::Index i = 0; i < 4; ++i) {
+    edges.push_back(Edge(i, (i + 1) % 4));
+    edges.push_back(Edge(i + 4, (i + 1) % 4 + 4));
+    edges.push_back(Edge(i, i + 4));
+  }
+  Rings rings = findMinimumCycleBasis(makeGraph(edges));
+  BOOST_REQUIRE_EQUAL(rings.size(), 5);
+  for (const auto& ring : rings) {
+    BOOST_CHECK_EQUAL(ring.size(), 4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ring_systems_test) {
+  // a triangle joined to a pentagon by a chain, and a separate
+  // bicyclo[2.2.2] cage of three six membered paths between 20 and 21
+  vector<Edge> edges{Edge(0, 1), Edge(1, 2), Edge(2, 0), Edge(2, 3),
+                     Edge(3, 4), Edge(4, 5), Edge(5, 6), Edge(6, 7),
+                     Edge(7, 8), Edge(8, 4)};
+  for (votca::Index path = 0; path < 3; ++path) {
+    votca::Index a = 22 + 2 * path;
+    edges.push_back(Edge(20, a));
+    edges.push_back(Edge(a, a + 1));
+    edges.push_back(Edge(a + 1, 21));
+  }
+  Rings rings = findMinimumCycleBasis(makeGraph(edges));
+  BOOST_REQUIRE_EQUAL(rings.size(), 4);
+  BOOST_CHECK(rings[0] == vector<votca::Index>({0, 1, 2}));
+  BOOST_CHECK(rings[1] == vector<votca::Index>({4, 5, 6, 7, 8}));
+  BOOST_CHECK_EQUAL(rings[2].size(), 6);
+  BOOST_CHECK_EQUAL(rings[3].size(), 6);
+}
+
+BOOST_AUTO_TEST_CASE(expanded_graph_test) {
+  // the ring survives reducing and expanding the graph
+  vector<ReducedEdge> reduced_edges{ReducedEdge(vector<votca::Index>{0, 1}),
+                                    ReducedEdge(vector<votca::Index>{1, 2, 3}),
+                                    ReducedEdge(vector<votca::Index>{3, 4, 5}),
+                                    ReducedEdge(vector<votca::Index>{1, 6, 3})};
+  ReducedGraph reduced_graph(reduced_edges);
+  BOOST_CHECK(reduced_graph.expandGraph().getRings() ==
+              Rings({{1, 2, 3, 6}}));
+  BOOST_CHECK(reduced_graph.getRings() == Rings({{1, 2, 3, 6}}));
+}
+
+BOOST_AUTO_TEST_CASE(reduced_graph_test) {
+  // benzene with one hydrogen, a ring without junctions becomes a self loop
+  // of the reduced graph
+  vector<Edge> benzene;
+  for (votca::Index i = 0; i < 6; ++i) {
+    benzene.emplace_back(i, (i + 1) % 6);
+  }
+  benzene.emplace_back(0, 6);
+  Graph benzene_graph = makeGraph(benzene);
+  BOOST_CHECK_EQUAL(benzene_graph.getRings().size(), 1);
+  BOOST_CHECK(reduceGraph(benzene_graph).getRings() ==
+              benzene_graph.getRings());
+
+  // naphthalene, the two rings become parallel edges between the junctions
+  vector<Edge> naphthalene{Edge(0, 1), Edge(1, 2), Edge(2, 3), Edge(3, 4),
+                           Edge(4, 9), Edge(9, 0), Edge(4, 5), Edge(5, 6),
+                           Edge(6, 7), Edge(7, 8), Edge(8, 9)};
+  Graph naphthalene_graph = makeGraph(naphthalene);
+  BOOST_CHECK_EQUAL(naphthalene_graph.getRings().size(), 2);
+  BOOST_CHECK(reduceGraph(naphthalene_graph).getRings() ==
+              naphthalene_graph.getRings());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,7 +21,9 @@
 // Standard includes
 #include <iostream>
 #include <set>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 
 // Third party includes
 #include <boost/test/unit_test.hpp>
@@ -94,4 +96,28 @@ BOOST_AUTO_TEST_CASE(hash_key_test) {
   e_map[2] = ed;
 }
 
+BOOST_AUTO_TEST_CASE(hash_collision_test) {
+  std::hash<Edge> hasher;
+  Edge ed1(1, 2);
+  Edge ed2(0, 3);
+  Edge ed3(2, 1);
+  BOOST_CHECK_EQUAL(hasher(ed1), hasher(ed3));
+  BOOST_CHECK(hasher(ed1) != hasher(ed2));
+
+  // all edges of a small dense graph map to distinct hashes
+  unordered_set<size_t> hashes;
+  votca::Index vertices = 200;
+  for (votca::Index i = 0; i < vertices; ++i) {
+    for (votca::Index j = i; j < vertices; ++j) {
+      hashes.insert(hasher(Edge(i, j)));
+    }
+  }
+  BOOST_CHECK_EQUAL(hashes.size(), size_t(vertices * (vertices + 1) / 2));
+}
+
+BOOST_AUTO_TEST_CASE(layout_test) {
+  BOOST_CHECK(std::is_trivially_copyable<Edge>::value);
+  BOOST_CHECK_EQUAL(sizeof(Edge), 2 * sizeof(votca::Index));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
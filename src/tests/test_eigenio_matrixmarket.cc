@@ -24,6 +24,7 @@
 // Local VOTCA includes
 #include "votca/tools/eigenio_matrixmarket.h"
 #include "votca/tools/votca_tools_config.h"
+#include <fstream>
 #include <iostream>
 
 using namespace votca::tools;
@@ -86,6 +87,20 @@ BOOST_AUTO_TEST_CASE(readmatrix_test) {
   BOOST_CHECK(check);
 }
 
+BOOST_AUTO_TEST_CASE(readmatrix_entries_test) {
+  std::ofstream extra("MatrixExtra.mm");
+  extra << "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n5\n";
+  extra.close();
+  BOOST_CHECK_THROW(EigenIO_MatrixMarket::ReadMatrix("MatrixExtra.mm"),
+                    std::runtime_error);
+
+  std::ofstream missing("MatrixMissing.mm");
+  missing << "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n";
+  missing.close();
+  BOOST_CHECK_THROW(EigenIO_MatrixMarket::ReadMatrix("MatrixMissing.mm"),
+                    std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(writematrix_test) {
 
   Eigen::MatrixXd test = Eigen::MatrixXd::Random(4, 3);
@@ -102,4 +117,52 @@ BOOST_AUTO_TEST_CASE(writematrix_test) {
   BOOST_CHECK(check);
 }
 
+BOOST_AUTO_TEST_CASE(writematrix_large_test) {
+
+  // large enough to be parsed and formatted in several chunks
+  Eigen::MatrixXd test = Eigen::MatrixXd::Random(1000, 500);
+  EigenIO_MatrixMarket::WriteMatrix("MatrixLarge.mm", test);
+  Eigen::MatrixXd readin = EigenIO_MatrixMarket::ReadMatrix("MatrixLarge.mm");
+  BOOST_CHECK_EQUAL(readin.rows(), 1000);
+  BOOST_CHECK_EQUAL(readin.cols(), 500);
+  // values are written with full precision
+  BOOST_CHECK(test == readin);
+}
+
+BOOST_AUTO_TEST_CASE(readsparsematrix_test) {
+
+  Eigen::MatrixXd ref = Eigen::MatrixXd::Zero(4, 4);
+  ref(0, 0) = 1.5;
+  ref(1, 0) = -2.0;
+  ref(0, 1) = -2.0;
+  ref(2, 2) = 3.0;
+  ref(3, 1) = 4.25;
+  ref(1, 3) = 4.25;
+  ref(3, 3) = -1.0;
+
+  Eigen::SparseMatrix<double> readin = EigenIO_MatrixMarket::ReadSparseMatrix(
+      std::string(TOOLS_TEST_DATA_FOLDER) +
+      "/eigenio_matrixmarket/eigen_sparse_symmetric.mm");
+
+  BOOST_CHECK_EQUAL(readin.nonZeros(), 7);
+  BOOST_CHECK(ref.isApprox(Eigen::MatrixXd(readin), 1e-10));
+  BOOST_CHECK_THROW(
+      EigenIO_MatrixMarket::ReadMatrix(
+          std::string(TOOLS_TEST_DATA_FOLDER) +
+          "/eigenio_matrixmarket/eigen_sparse_symmetric.mm"),
+      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(writesparsematrix_test) {
+
+  Eigen::MatrixXd dense = Eigen::MatrixXd::Random(20, 30);
+  dense = (dense.array() > 0.5).select(dense, 0.0);
+  Eigen::SparseMatrix<double> test = dense.sparseView();
+  EigenIO_MatrixMarket::WriteSparseMatrix("SparseRandom.mm", test);
+  Eigen::SparseMatrix<double> readin =
+      EigenIO_MatrixMarket::ReadSparseMatrix("SparseRandom.mm");
+  BOOST_CHECK_EQUAL(readin.nonZeros(), test.nonZeros());
+  BOOST_CHECK(dense == Eigen::MatrixXd(readin));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
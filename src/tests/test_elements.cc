@@ -22,6 +22,7 @@
 // Standard includes
 #include <cmath>
 #include <exception>
+#include <vector>
 
 // Third party includes
 #include <boost/test/unit_test.hpp>
@@ -34,7 +35,10 @@ using namespace votca::tools;
 
 BOOST_AUTO_TEST_SUITE(elements_test)
 
-BOOST_AUTO_TEST_CASE(constructors_test) { Elements ele; }
+BOOST_AUTO_TEST_CASE(constructors_test) {
+  BOOST_CHECK(Elements().isElement("H"));
+  BOOST_CHECK(!Elements().isElement("Blah"));
+}
 
 BOOST_AUTO_TEST_CASE(accessors_test) {
   Elements ele;
@@ -76,4 +80,56 @@ BOOST_AUTO_TEST_CASE(accessors_test) {
   BOOST_CHECK(!ele.isEleShort("CARBON"));
 }
 
+BOOST_AUTO_TEST_CASE(elenum_accessors_test) {
+  Elements ele;
+  BOOST_CHECK_EQUAL(ele.getMass(19), 39.098);
+  BOOST_CHECK_EQUAL(ele.getNucCrg(6), 6);
+  BOOST_CHECK_EQUAL(ele.getVdWChelpG(1), 1.45);
+  BOOST_CHECK_EQUAL(ele.getVdWMK(9), 1.35);
+  BOOST_CHECK_EQUAL(ele.getPolarizability(9), 0.440e-3);
+  BOOST_CHECK_CLOSE(ele.getCovRad(17, "ang"), 1.02, 1e-3);
+  BOOST_CHECK_THROW(ele.getMass(0), runtime_error);
+  BOOST_CHECK_THROW(ele.getMass(60), runtime_error);
+  BOOST_CHECK_THROW(ele.getMass(87), runtime_error);
+  BOOST_CHECK_THROW(ele.getVdWMK(82), runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(symbol_lookup_test) {
+  Elements ele;
+  // every symbol maps back to its own element number
+  for (votca::Index i = 1; i <= 86; i++) {
+    if (i > 56 && i < 72) {
+      BOOST_CHECK_THROW(ele.getEleName(i), runtime_error);
+      continue;
+    }
+    std::string symbol = ele.getEleName(i);
+    BOOST_CHECK_EQUAL(Elements::SymbolToEleNum(symbol), i);
+    BOOST_CHECK_EQUAL(ele.getEleShort(ele.getEleFull(symbol)), symbol);
+  }
+  BOOST_CHECK_EQUAL(Elements::SymbolToEleNum(""), 0);
+  BOOST_CHECK_EQUAL(Elements::SymbolToEleNum("c"), 0);
+  BOOST_CHECK_EQUAL(Elements::SymbolToEleNum("CL"), 0);
+  BOOST_CHECK_EQUAL(Elements::SymbolToEleNum("Xx"), 0);
+  BOOST_CHECK_EQUAL(Elements::SymbolToEleNum("Cl1"), 0);
+  BOOST_CHECK_EQUAL(ele.getEleShort("Nitrogen"), "N");
+  BOOST_CHECK_EQUAL(ele.getEleShort("LEAD"), "Pb");
+}
+
+BOOST_AUTO_TEST_CASE(closest_in_mass_test) {
+  Elements ele;
+  // below the lightest and above the heaviest element
+  BOOST_CHECK_EQUAL(ele.getEleShortClosestInMass(0.9, 0.2), "H");
+  BOOST_CHECK_EQUAL(ele.getEleShortClosestInMass(230.0, 0.1), "Rn");
+  // Co (58.933) and Ni (58.693)
+  BOOST_CHECK_EQUAL(ele.getEleShortClosestInMass(58.7, 0.01), "Ni");
+  BOOST_CHECK_EQUAL(ele.getEleShortClosestInMass(58.9, 0.01), "Co");
+  BOOST_CHECK_THROW(ele.getEleShortClosestInMass(13.0, 0.01), runtime_error);
+
+  std::vector<double> masses = {12.01, 1.008, 15.999, 13.0, 207.2};
+  std::vector<votca::Index> elenums = ele.getEleNumClosestInMass(masses, 0.01);
+  std::vector<votca::Index> ref = {6, 1, 8, 0, 82};
+  BOOST_CHECK_EQUAL_COLLECTIONS(elenums.begin(), elenums.end(), ref.begin(),
+                                ref.end());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
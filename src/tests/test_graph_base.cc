@@ -23,6 +23,9 @@
 #include <cmath>
 #include <exception>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
 // Third party includes
 #include <boost/test/unit_test.hpp>
@@ -634,4 +637,80 @@ BOOST_AUTO_TEST_CASE(id_test) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(setnodes_test) {
+  unordered_map<string, votca::Index> int_vals0 = {{"a", 0}};
+  unordered_map<string, votca::Index> int_vals1 = {{"b", 1}};
+  unordered_map<string, votca::Index> int_vals2 = {{"c", 2}};
+  unordered_map<string, double> double_vals;
+  unordered_map<string, string> str_vals;
+
+  GraphNode gn0(int_vals0, double_vals, str_vals);
+  GraphNode gn1(int_vals1, double_vals, str_vals);
+  GraphNode gn2(int_vals2, double_vals, str_vals);
+
+  vector<Edge> vec_ed = {Edge(0, 1), Edge(1, 2)};
+  unordered_map<votca::Index, GraphNode> m_gn = {{0, gn0}, {1, gn0}, {2, gn0}};
+  Graph g(vec_ed, m_gn);
+  BOOST_CHECK_EQUAL(g.getId(), "a0a0a0");
+
+  // the id follows single and batched updates
+  g.setNode(1, gn2);
+  BOOST_CHECK_EQUAL(g.getId(), "a0a0c2");
+  g.setNodes({{0, gn2}, {2, gn1}});
+  BOOST_CHECK_EQUAL(g.getId(), "b1c2c2");
+
+  unordered_map<votca::Index, GraphNode> m_gn2 = {{0, gn1}, {1, gn2}, {2, gn2}};
+  Graph g2(vec_ed, m_gn2);
+  BOOST_CHECK(g == g2);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_id_test) {
+  // a chain of triangles, so the graph has rings as well
+  vector<Edge> vec_ed;
+  unordered_map<votca::Index, GraphNode> m_gn;
+  for (votca::Index vertex = 0; vertex < 600; ++vertex) {
+    m_gn[vertex] = GraphNode({{"a", vertex % 7}}, {}, {});
+    if (vertex > 0) {
+      vec_ed.push_back(Edge(vertex - 1, vertex));
+    }
+    if (vertex % 2 == 0 && vertex > 1) {
+      vec_ed.push_back(Edge(vertex - 2, vertex));
+    }
+  }
+
+  for (votca::Index round = 0; round < 5; ++round) {
+    Graph g(vec_ed, m_gn);
+    Graph reference(vec_ed, m_gn);
+    string id = reference.getId();
+    size_t nrings = reference.getRings().size();
+    BOOST_CHECK_EQUAL(nrings, 299);
+
+    // the first requests of several threads race for the lazy values
+    vector<string> ids(4);
+    vector<size_t> rings(4);
+    vector<string> copied_ids(4);
+    vector<thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+      threads.emplace_back([&, i]() {
+        if (i % 2) {
+          copied_ids[i] = Graph(g).getId();
+        }
+        ids[i] = g.getId();
+        rings[i] = g.getRings().size();
+      });
+    }
+    for (thread& t : threads) {
+      t.join();
+    }
+    for (size_t i = 0; i < 4; ++i) {
+      BOOST_CHECK_EQUAL(ids[i], id);
+      BOOST_CHECK_EQUAL(rings[i], nrings);
+      if (i % 2) {
+        BOOST_CHECK_EQUAL(copied_ids[i], id);
+      }
+    }
+    m_gn[round] = GraphNode({{"b", round}}, {}, {});
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -211,4 +211,33 @@ BOOST_AUTO_TEST_CASE(basic_test2) {
   BOOST_CHECK(v4);
 }
 
+BOOST_AUTO_TEST_CASE(reset_test) {
+
+  // Sparse and negative vertex ids exercise the stamp fallback
+  vector<Edge> edges{Edge(-3, 100000), Edge(100000, 7), Edge(7, -3)};
+  unordered_map<votca::Index, GraphNode> nodes;
+  nodes[-3] = GraphNode();
+  nodes[7] = GraphNode();
+  nodes[100000] = GraphNode();
+  Graph g(edges, nodes);
+
+  Graph_DF_Visitor v;
+  v.setStartingVertex(-3);
+  for (int pass = 0; pass < 2; ++pass) {
+    v.initialize(g);
+    while (!v.queEmpty()) {
+      Edge ed = v.nextEdge(g);
+      v.exec(g, ed);
+    }
+    BOOST_CHECK_EQUAL(v.getExploredCount(), 3);
+    auto explored = v.getExploredVertices();
+    BOOST_CHECK_EQUAL(explored.count(-3), 1);
+    BOOST_CHECK_EQUAL(explored.count(7), 1);
+    BOOST_CHECK_EQUAL(explored.count(100000), 1);
+    v.reset();
+    BOOST_CHECK_EQUAL(v.getExploredCount(), 0);
+    BOOST_CHECK(v.queEmpty());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,298 @@
+/*
+ *            Copyright 2009-2020 The VOTCA Development Team
+ *                       (http://www.votca.org)
+ *
+ *      Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * You may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *              http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE graphcache_test
+
+// Standard includes
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/graph_bf_visitor.h"
+#include "votca/tools/graphcache.h"
+#include "votca/tools/graphdistvisitor.h"
+
+using namespace std;
+using namespace votca::tools;
+
+namespace {
+//  1 - 2 - 3
+//      |   |
+//      4 - 5 - 6 - 7
+void makeDefinition(vector<Edge>& edges,
+                    unordered_map<votca::Index, GraphNode>& nodes) {
+  edges = {Edge(1, 2), Edge(2, 3), Edge(2, 4), Edge(4, 5),
+           Edge(3, 5), Edge(5, 6), Edge(6, 7)};
+  nodes.clear();
+  for (votca::Index vertex = 1; vertex < 8; ++vertex) {
+    nodes[vertex] =
+        GraphNode({{"Index", vertex}}, {{"Mass", 1.5 * double(vertex)}},
+                  {{"Element", vertex % 2 ? "C" : "O"}});
+  }
+}
+
+const string dist_key = GraphCache::VisitorKey<GraphDistVisitor>();
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(graphcache_test)
+
+BOOST_AUTO_TEST_CASE(content_hash_test) {
+  vector<Edge> edges;
+  unordered_map<votca::Index, GraphNode> nodes;
+  makeDefinition(edges, nodes);
+  auto hash = GraphSerializer::ContentHash(edges, nodes);
+
+  vector<Edge> reversed(edges.rbegin(), edges.rend());
+  BOOST_CHECK_EQUAL(GraphSerializer::ContentHash(reversed, nodes), hash);
+
+  nodes[3] = GraphNode({{"Index", 3}}, {{"Mass", 4.5}}, {{"Element", "N"}});
+  BOOST_CHECK(GraphSerializer::ContentHash(edges, nodes) != hash);
+  makeDefinition(edges, nodes);
+  edges.push_back(Edge(1, 7));
+  BOOST_CHECK(GraphSerializer::ContentHash(edges, nodes) != hash);
+}
+
+BOOST_AUTO_TEST_CASE(round_trip_test) {
+  vector<Edge> edges;
+  unordered_map<votca::Index, GraphNode> nodes;
+  makeDefinition(edges, nodes);
+  // an isolated vertex without edges
+  nodes[8] = GraphNode();
+  Graph graph(edges, nodes);
+  ReducedGraph reduced_graph = reduceGraph(graph);
+
+  vector<char> buffer;
+  GraphSerializer::Write(graph, buffer);
+  GraphSerializer::Write(reduced_graph, buffer);
+
+  Graph graph_read;
+  ReducedGraph reduced_graph_read;
+  const char* data = buffer.data();
+  const char* end = data + buffer.size();
+  GraphSerializer::Read(data, end, graph_read);
+  GraphSerializer::Read(data, end, reduced_graph_read);
+  BOOST_CHECK(data == end);
+
+  BOOST_CHECK(graph_read == graph);
+  BOOST_CHECK_EQUAL(graph_read.getId(), graph.getId());
+  BOOST_CHECK_EQUAL(graph_read.getVertices().size(), 8);
+  BOOST_CHECK(graph_read.edgeExist(Edge(3, 5)));
+  BOOST_CHECK_EQUAL(graph_read.getNode(4).getDouble("Mass"), 6.0);
+  BOOST_CHECK_EQUAL(graph_read.getNode(4).getStr("Element"), "O");
+
+  BOOST_CHECK_EQUAL(reduced_graph_read.getId(), reduced_graph.getId());
+  auto junctions = reduced_graph.getJunctions();
+  auto junctions_read = reduced_graph_read.getJunctions();
+  sort(junctions.begin(), junctions.end());
+  sort(junctions_read.begin(), junctions_read.end());
+  BOOST_CHECK(junctions_read == junctions);
+  auto expanded = reduced_graph.expandEdge(Edge(2, 5));
+  auto expanded_read = reduced_graph_read.expandEdge(Edge(2, 5));
+  BOOST_CHECK_EQUAL(expanded_read.size(), expanded.size());
+  BOOST_CHECK(expanded_read == expanded);
+
+  // truncated data is rejected
+  data = buffer.data();
+  Graph truncated;
+  BOOST_CHECK_THROW(GraphSerializer::Read(data, data + 20, truncated),
+                    runtime_error);
+
+  // counts too large for the data are rejected before allocating
+  for (std::uint64_t count : {std::uint64_t(1) << 61, ~std::uint64_t(0)}) {
+    vector<char> bad(2 * sizeof(std::uint64_t) + 64, 0);
+    std::uint64_t no_nodes = 0;
+    memcpy(bad.data(), &no_nodes, sizeof(no_nodes));
+    memcpy(bad.data() + sizeof(no_nodes), &count, sizeof(count));
+    data = bad.data();
+    BOOST_CHECK_THROW(
+        GraphSerializer::Read(data, data + bad.size(), truncated),
+        runtime_error);
+    memcpy(bad.data(), &count, sizeof(count));
+    data = bad.data();
+    BOOST_CHECK_THROW(
+        GraphSerializer::Read(data, data + bad.size(), truncated),
+        runtime_error);
+  }
+
+  // chain offsets which do not describe ranges of the chain vertices
+  vector<char> graph_only;
+  GraphSerializer::Write(static_cast<const Graph&>(reduced_graph), graph_only);
+  vector<char> bad_offsets;
+  GraphSerializer::Write(reduced_graph, bad_offsets);
+  std::uint64_t nvertices = 0;
+  memcpy(&nvertices, bad_offsets.data() + graph_only.size(),
+         sizeof(nvertices));
+  size_t first_offset = graph_only.size() + 2 * sizeof(std::uint64_t) +
+                        nvertices * sizeof(votca::Index);
+  votca::Index offset = 1;
+  memcpy(bad_offsets.data() + first_offset, &offset, sizeof(offset));
+  data = bad_offsets.data();
+  ReducedGraph reduced_bad;
+  BOOST_CHECK_THROW(GraphSerializer::Read(data, data + bad_offsets.size(),
+                                          reduced_bad),
+                    runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(cache_test) {
+  vector<Edge> edges;
+  unordered_map<votca::Index, GraphNode> nodes;
+  makeDefinition(edges, nodes);
+  auto hash = GraphCache::Hash(edges, nodes, dist_key);
+
+  GraphCache cache(".");
+  remove(cache.getFileName(hash).c_str());
+  GraphCache::Entry entry;
+  BOOST_CHECK(cache.Load(edges, nodes, dist_key, entry) == false);
+
+  GraphCache::Entry built = cache.GetOrBuild<GraphDistVisitor>(edges, nodes);
+  BOOST_CHECK(ifstream(cache.getFileName(hash)).good());
+  BOOST_CHECK(cache.Load(edges, nodes, dist_key, entry));
+  BOOST_CHECK_EQUAL(entry.structure_id, built.structure_id);
+  BOOST_CHECK_EQUAL(entry.graph.getId(), built.graph.getId());
+  BOOST_CHECK_EQUAL(entry.reduced_graph.getId(), built.reduced_graph.getId());
+
+  GraphCache::Entry loaded = cache.GetOrBuild<GraphDistVisitor>(edges, nodes);
+  BOOST_CHECK_EQUAL(loaded.structure_id, built.structure_id);
+  BOOST_CHECK(loaded.graph == built.graph);
+  remove(cache.getFileName(hash).c_str());
+}
+
+BOOST_AUTO_TEST_CASE(visitor_test) {
+  vector<Edge> edges;
+  unordered_map<votca::Index, GraphNode> nodes;
+  makeDefinition(edges, nodes);
+  const string bf_key = GraphCache::VisitorKey<Graph_BF_Visitor>();
+  BOOST_CHECK(bf_key != dist_key);
+  auto dist_hash = GraphCache::Hash(edges, nodes, dist_key);
+  auto bf_hash = GraphCache::Hash(edges, nodes, bf_key);
+  BOOST_CHECK(dist_hash != bf_hash);
+
+  GraphCache cache(".");
+  remove(cache.getFileName(dist_hash).c_str());
+  remove(cache.getFileName(bf_hash).c_str());
+  GraphCache::Entry dist = cache.GetOrBuild<GraphDistVisitor>(edges, nodes);
+  // the entry of the other visitor is neither loaded nor replaced
+  GraphCache::Entry entry;
+  BOOST_CHECK(cache.Load(edges, nodes, bf_key, entry) == false);
+  GraphCache::Entry bf = cache.GetOrBuild<Graph_BF_Visitor>(edges, nodes);
+  Graph graph(edges, nodes);
+  BOOST_CHECK_EQUAL(bf.structure_id, findStructureId<Graph_BF_Visitor>(graph));
+  BOOST_CHECK(bf.structure_id != dist.structure_id);
+
+  BOOST_CHECK(cache.Load(edges, nodes, dist_key, entry));
+  BOOST_CHECK_EQUAL(entry.structure_id, dist.structure_id);
+  BOOST_CHECK(cache.Load(edges, nodes, bf_key, entry));
+  BOOST_CHECK_EQUAL(entry.structure_id, bf.structure_id);
+  remove(cache.getFileName(dist_hash).c_str());
+  remove(cache.getFileName(bf_hash).c_str());
+}
+
+BOOST_AUTO_TEST_CASE(mismatch_test) {
+  vector<Edge> edges;
+  unordered_map<votca::Index, GraphNode> nodes;
+  makeDefinition(edges, nodes);
+  auto hash = GraphCache::Hash(edges, nodes, dist_key);
+  vector<Edge> other_edges = edges;
+  other_edges.push_back(Edge(1, 7));
+  auto other_hash = GraphCache::Hash(other_edges, nodes, dist_key);
+
+  GraphCache cache(".");
+  cache.GetOrBuild<GraphDistVisitor>(edges, nodes);
+  GraphCache::Entry other_built =
+      cache.GetOrBuild<GraphDistVisitor>(other_edges, nodes);
+
+  // the file of the other definition now holds this one, as it would after
+  // a hash collision
+  {
+    ifstream source(cache.getFileName(hash), ios::binary);
+    ofstream target(cache.getFileName(other_hash), ios::binary | ios::trunc);
+    target << source.rdbuf();
+  }
+  GraphCache::Entry entry;
+  BOOST_CHECK(cache.Load(other_edges, nodes, dist_key, entry) == false);
+  // even with the hash stored in the file matching, the definition differs
+  {
+    fstream file(cache.getFileName(other_hash),
+                 ios::binary | ios::in | ios::out);
+    file.seekp(8 + sizeof(std::uint32_t));
+    file.write(reinterpret_cast<const char*>(&other_hash), sizeof(other_hash));
+  }
+  BOOST_CHECK(cache.Load(other_edges, nodes, dist_key, entry) == false);
+  GraphCache::Entry rebuilt =
+      cache.GetOrBuild<GraphDistVisitor>(other_edges, nodes);
+  BOOST_CHECK(rebuilt.graph.edgeExist(Edge(1, 7)));
+  BOOST_CHECK_EQUAL(rebuilt.structure_id, other_built.structure_id);
+  BOOST_CHECK(cache.Load(other_edges, nodes, dist_key, entry));
+  BOOST_CHECK(entry.graph.edgeExist(Edge(1, 7)));
+  BOOST_CHECK(entry.graph == other_built.graph);
+
+  remove(cache.getFileName(hash).c_str());
+  remove(cache.getFileName(other_hash).c_str());
+}
+
+BOOST_AUTO_TEST_CASE(corrupt_test) {
+  vector<Edge> edges;
+  unordered_map<votca::Index, GraphNode> nodes;
+  makeDefinition(edges, nodes);
+  auto hash = GraphCache::Hash(edges, nodes, dist_key);
+
+  GraphCache cache(".");
+  remove(cache.getFileName(hash).c_str());
+  GraphCache::Entry built = cache.GetOrBuild<GraphDistVisitor>(edges, nodes);
+  string contents;
+  {
+    ifstream file(cache.getFileName(hash), ios::binary);
+    contents.assign(istreambuf_iterator<char>(file),
+                    istreambuf_iterator<char>());
+  }
+
+  vector<string> corrupted = {contents.substr(0, contents.size() / 2),
+                              contents.substr(0, 4), "not a cache file"};
+  for (const string& bad : corrupted) {
+    {
+      ofstream file(cache.getFileName(hash), ios::binary | ios::trunc);
+      file << bad;
+    }
+    GraphCache::Entry entry;
+    BOOST_CHECK(cache.Load(edges, nodes, dist_key, entry) == false);
+    GraphCache::Entry rebuilt;
+    BOOST_CHECK_NO_THROW(rebuilt =
+                             cache.GetOrBuild<GraphDistVisitor>(edges, nodes));
+    BOOST_CHECK_EQUAL(rebuilt.structure_id, built.structure_id);
+    // the rebuilt entry replaced the corrupt file
+    BOOST_CHECK(cache.Load(edges, nodes, dist_key, entry));
+    BOOST_CHECK_EQUAL(entry.structure_id, built.structure_id);
+  }
+  remove(cache.getFileName(hash).c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
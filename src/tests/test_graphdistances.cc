@@ -0,0 +1,215 @@
+/*
+ *            Copyright 2009-2020 The VOTCA Development Team
+ *                       (http://www.votca.org)
+ *
+ *      Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * You may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *              http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE graphdistances_test
+
+// Standard includes
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/graph.h"
+#include "votca/tools/graphdistances.h"
+#include "votca/tools/graphdistvisitor.h"
+#include "votca/tools/graphnode.h"
+#include "votca/tools/threadpool.h"
+
+using namespace std;
+using namespace votca::tools;
+
+namespace {
+Graph makeGraph(const vector<Edge>& edges, votca::Index nvertices) {
+  unordered_map<votca::Index, GraphNode> nodes;
+  for (votca::Index i = 0; i < nvertices; ++i) {
+    nodes[i] = GraphNode();
+  }
+  return Graph(edges, nodes);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(graphdistances_test)
+
+BOOST_AUTO_TEST_CASE(chain_test) {
+  // 0 - 1 - 2 - 3
+  Graph g = makeGraph({Edge(0, 1), Edge(1, 2), Edge(2, 3)}, 4);
+  GraphDistances distances(g);
+
+  auto neighbors = distances.Neighbors(1, 1);
+  BOOST_REQUIRE_EQUAL(neighbors.size(), 2);
+  BOOST_CHECK_EQUAL(neighbors[0].vertex, 0);
+  BOOST_CHECK_EQUAL(neighbors[0].distance, 1);
+  BOOST_CHECK_EQUAL(neighbors[1].vertex, 2);
+  BOOST_CHECK_EQUAL(neighbors[1].distance, 1);
+
+  neighbors = distances.Neighbors(0, 10);
+  BOOST_REQUIRE_EQUAL(neighbors.size(), 3);
+  BOOST_CHECK_EQUAL(neighbors[2].vertex, 3);
+  BOOST_CHECK_EQUAL(neighbors[2].distance, 3);
+
+  BOOST_CHECK(distances.Neighbors(0, 0).empty());
+  BOOST_CHECK_THROW(distances.Neighbors(7, 1), runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(disconnected_test) {
+  // 0 - 1   2 - 3   4
+  Graph g = makeGraph({Edge(0, 1), Edge(2, 3)}, 5);
+  GraphDistances distances(g);
+  BOOST_CHECK_EQUAL(distances.getVertices().size(), 5);
+
+  auto all = distances.AllNeighbors(5);
+  BOOST_REQUIRE_EQUAL(all.size(), 5);
+  BOOST_CHECK_EQUAL(all[0].size(), 1);
+  BOOST_CHECK_EQUAL(all[3].size(), 1);
+  BOOST_CHECK_EQUAL(all[3][0].vertex, 2);
+  BOOST_CHECK(all[4].empty());
+}
+
+BOOST_AUTO_TEST_CASE(matrix_test) {
+  // 0 - 1 - 2 with a loop on 2 and a ring 2 - 3 - 4 - 2
+  Graph g = makeGraph(
+      {Edge(0, 1), Edge(1, 2), Edge(2, 2), Edge(2, 3), Edge(3, 4), Edge(4, 2)},
+      5);
+  GraphDistances distances(g);
+  Eigen::SparseMatrix<votca::Index> matrix = distances.DistanceMatrix(2);
+  BOOST_CHECK_EQUAL(matrix.rows(), 5);
+  BOOST_CHECK_EQUAL(matrix.coeff(0, 1), 1);
+  BOOST_CHECK_EQUAL(matrix.coeff(0, 2), 2);
+  BOOST_CHECK_EQUAL(matrix.coeff(0, 3), 0);
+  BOOST_CHECK_EQUAL(matrix.coeff(2, 2), 0);
+  BOOST_CHECK_EQUAL(matrix.coeff(1, 4), 2);
+  BOOST_CHECK_EQUAL(matrix.coeff(3, 4), 1);
+  Eigen::Matrix<votca::Index, Eigen::Dynamic, Eigen::Dynamic> dense =
+      matrix.toDense();
+  BOOST_CHECK(dense == dense.transpose());
+}
+
+BOOST_AUTO_TEST_CASE(visitor_comparison_test) {
+  std::mt19937 rng(13);
+  votca::Index nvertices = 60;
+  std::uniform_int_distribution<votca::Index> pick(0, nvertices - 1);
+  vector<Edge> edges;
+  for (votca::Index i = 1; i < nvertices; ++i) {
+    edges.push_back(Edge(i, pick(rng) % i));
+  }
+  for (votca::Index i = 0; i < 20; ++i) {
+    edges.push_back(Edge(pick(rng), pick(rng)));
+  }
+  Graph g = makeGraph(edges, nvertices);
+  GraphDistances distances(g);
+  votca::Index max_distance = 4;
+  auto all = distances.AllNeighbors(max_distance);
+
+  for (votca::Index source : {0, 17, 59}) {
+    Graph labelled = g;
+    GraphDistVisitor gdv;
+    gdv.setStartingVertex(source);
+    gdv.initialize(labelled);
+    while (!gdv.queEmpty()) {
+      Edge ed = gdv.nextEdge(labelled);
+      gdv.exec(labelled, ed);
+    }
+    unordered_map<votca::Index, votca::Index> expected;
+    for (votca::Index v = 0; v < nvertices; ++v) {
+      votca::Index dist = labelled.getNode(v).getInt("Dist");
+      if (v != source && dist <= max_distance) {
+        expected[v] = dist;
+      }
+    }
+    BOOST_REQUIRE_EQUAL(all[source].size(), expected.size());
+    for (const auto& neighbor : all[source]) {
+      BOOST_CHECK_EQUAL(expected.at(neighbor.vertex), neighbor.distance);
+    }
+    auto serial = distances.Neighbors(source, max_distance);
+    BOOST_REQUIRE_EQUAL(serial.size(), all[source].size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+      BOOST_CHECK_EQUAL(serial[i].vertex, all[source][i].vertex);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_callers_test) {
+  std::mt19937 rng(7);
+  votca::Index nvertices = 4000;
+  std::uniform_int_distribution<votca::Index> pick(0, nvertices - 1);
+  vector<Edge> edges;
+  for (votca::Index i = 0; i < 2 * nvertices; ++i) {
+    votca::Index v1 = pick(rng);
+    votca::Index v2 = pick(rng);
+    if (v1 != v2) {
+      edges.push_back(Edge(v1, v2));
+    }
+  }
+  GraphDistances distances(makeGraph(edges, nvertices));
+  votca::Index max_distance = 4;
+  vector<vector<GraphDistances::Neighbor>> expected;
+  for (votca::Index v : distances.getVertices()) {
+    expected.push_back(distances.Neighbors(v, max_distance));
+  }
+
+  auto same = [&](const vector<vector<GraphDistances::Neighbor>>& all) {
+    if (all.size() != expected.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < all.size(); ++i) {
+      if (all[i].size() != expected[i].size()) {
+        return false;
+      }
+      for (size_t j = 0; j < all[i].size(); ++j) {
+        if (all[i][j].vertex != expected[i][j].vertex ||
+            all[i][j].distance != expected[i][j].distance) {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+
+  // several workers even on machines with a single core, no other thread
+  // uses the pool while it is resized
+  ThreadPool& pool = ThreadPool::Global();
+  votca::Index pool_size = pool.size();
+  pool.Resize(4);
+  std::atomic<votca::Index> mismatches{0};
+  vector<std::thread> callers;
+  for (votca::Index c = 0; c < 3; ++c) {
+    callers.emplace_back([&]() {
+      for (votca::Index repeat = 0; repeat < 5; ++repeat) {
+        if (!same(distances.AllNeighbors(max_distance))) {
+          mismatches++;
+        }
+      }
+    });
+  }
+  for (std::thread& caller : callers) {
+    caller.join();
+  }
+  pool.Resize(pool_size);
+  BOOST_CHECK_EQUAL(mismatches, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
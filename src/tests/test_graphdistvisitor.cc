@@ -193,4 +193,28 @@ BOOST_AUTO_TEST_CASE(basic_test2) {
   BOOST_CHECK_EQUAL(dist, 1);
 }
 
+BOOST_AUTO_TEST_CASE(long_chain_test) {
+  // setting a node no longer recalculates the graph id, so labelling a long
+  // chain takes linear time
+  votca::Index length = 100000;
+  vector<Edge> edges;
+  unordered_map<votca::Index, GraphNode> nodes;
+  for (votca::Index i = 0; i < length; ++i) {
+    nodes[i] = GraphNode();
+    if (i > 0) {
+      edges.push_back(Edge(i - 1, i));
+    }
+  }
+  Graph g(edges, nodes);
+
+  GraphDistVisitor gdv;
+  gdv.initialize(g);
+  while (!gdv.queEmpty()) {
+    Edge ed = gdv.nextEdge(g);
+    gdv.exec(g, ed);
+  }
+  BOOST_CHECK_EQUAL(g.getNode(length - 1).getInt("Dist"), length - 1);
+  BOOST_CHECK_EQUAL(g.getNode(length / 2).getInt("Dist"), length / 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,173 @@
+/*
+ *            Copyright 2009-2020 The VOTCA Development Team
+ *                       (http://www.votca.org)
+ *
+ *      Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * You may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *              http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE graphmatcher_test
+
+// Standard includes
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/graph.h"
+#include "votca/tools/graphmatcher.h"
+#include "votca/tools/graphnode.h"
+
+using namespace std;
+using namespace votca::tools;
+
+namespace {
+// atoms are labelled by element name, vertex ids are shifted by offset
+Graph makeMolecule(const vector<string>& elements,
+                   const vector<pair<votca::Index, votca::Index>>& bonds,
+                   votca::Index offset) {
+  unordered_map<votca::Index, GraphNode> nodes;
+  for (votca::Index i = 0; i < votca::Index(elements.size()); ++i) {
+    nodes[i + offset] = GraphNode({}, {}, {{"Element", elements[i]}});
+  }
+  vector<Edge> edges;
+  for (const auto& bond : bonds) {
+    edges.push_back(Edge(bond.first + offset, bond.second + offset));
+  }
+  return Graph(edges, nodes);
+}
+
+bool isValidMapping(const Graph& pattern, const Graph& target,
+                    const unordered_map<votca::Index, votca::Index>& mapping) {
+  if (mapping.size() != pattern.getVertices().size()) {
+    return false;
+  }
+  for (const auto& vertices : mapping) {
+    if (pattern.getNode(vertices.first).getStringId() !=
+        target.getNode(vertices.second).getStringId()) {
+      return false;
+    }
+  }
+  for (const Edge& edge : pattern.getEdges()) {
+    if (!target.edgeExist(Edge(mapping.at(edge.getEndPoint1()),
+                               mapping.at(edge.getEndPoint2())))) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(graphmatcher_test)
+
+BOOST_AUTO_TEST_CASE(isomorphism_test) {
+  // ethanol C0 - C1 - O2 with its hydrogens
+  Graph pattern = makeMolecule(
+      {"C", "C", "O", "H", "H", "H", "H", "H", "H"},
+      {{0, 1}, {1, 2}, {0, 3}, {0, 4}, {0, 5}, {1, 6}, {1, 7}, {2, 8}}, 0);
+  // the same molecule with the atoms listed in a different order
+  Graph target = makeMolecule(
+      {"H", "O", "H", "C", "H", "C", "H", "H", "H"},
+      {{3, 5}, {5, 1}, {0, 1}, {3, 2}, {3, 4}, {3, 6}, {5, 7}, {5, 8}}, 20);
+
+  GraphMatcher matcher(pattern);
+  auto mapping = matcher.Isomorphism(target);
+  BOOST_CHECK(isValidMapping(pattern, target, mapping));
+  BOOST_CHECK_EQUAL(mapping.at(2), 21);
+  BOOST_CHECK_EQUAL(mapping.at(8), 20);
+
+  // dimethyl ether has the same atoms but a different topology
+  Graph ether = makeMolecule(
+      {"C", "O", "C", "H", "H", "H", "H", "H", "H"},
+      {{0, 1}, {1, 2}, {0, 3}, {0, 4}, {0, 5}, {2, 6}, {2, 7}, {2, 8}}, 0);
+  BOOST_CHECK(matcher.Isomorphism(ether).empty());
+}
+
+BOOST_AUTO_TEST_CASE(same_signature_test) {
+  // a hexagon and two triangles have the same labels and degrees
+  vector<string> carbons(6, "C");
+  Graph hexagon = makeMolecule(
+      carbons, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 0}}, 0);
+  Graph triangles = makeMolecule(
+      carbons, {{0, 1}, {1, 2}, {2, 0}, {3, 4}, {4, 5}, {5, 3}}, 0);
+  GraphMatcher matcher(hexagon);
+  BOOST_CHECK(matcher.Isomorphism(triangles).empty());
+  BOOST_CHECK(!matcher.Isomorphism(hexagon).empty());
+
+  GraphMatcher triangle_matcher(triangles);
+  auto mapping = triangle_matcher.Isomorphism(triangles);
+  BOOST_CHECK(isValidMapping(triangles, triangles, mapping));
+}
+
+BOOST_AUTO_TEST_CASE(cache_test) {
+  vector<string> elements{"O", "H", "H"};
+  vector<pair<votca::Index, votca::Index>> bonds{{0, 1}, {0, 2}};
+  Graph pattern = makeMolecule(elements, bonds, 0);
+  GraphMatcher matcher(pattern);
+  BOOST_CHECK_EQUAL(matcher.CacheSize(), 0);
+
+  for (votca::Index molecule = 0; molecule < 100; ++molecule) {
+    Graph water = makeMolecule(elements, bonds, 3 * molecule);
+    auto mapping = matcher.Isomorphism(water);
+    BOOST_REQUIRE(isValidMapping(pattern, water, mapping));
+    BOOST_CHECK_EQUAL(mapping.at(0), 3 * molecule);
+  }
+  BOOST_CHECK_EQUAL(matcher.CacheSize(), 1);
+
+  // same id but a different atom order, the cached mapping is rejected
+  Graph shuffled = makeMolecule({"H", "O", "H"}, {{1, 0}, {1, 2}}, 0);
+  auto mapping = matcher.Isomorphism(shuffled);
+  BOOST_CHECK(isValidMapping(pattern, shuffled, mapping));
+  BOOST_CHECK_EQUAL(mapping.at(0), 1);
+}
+
+BOOST_AUTO_TEST_CASE(subgraph_test) {
+  // hydroxyl group
+  Graph pattern = makeMolecule({"O", "H"}, {{0, 1}}, 0);
+  // two waters and a methanol
+  Graph target = makeMolecule(
+      {"O", "H", "H", "O", "H", "H", "C", "O", "H", "H", "H", "H"},
+      {{0, 1},
+       {0, 2},
+       {3, 4},
+       {3, 5},
+       {6, 7},
+       {7, 8},
+       {6, 9},
+       {6, 10},
+       {6, 11}},
+      0);
+  GraphMatcher matcher(pattern);
+  auto matches = matcher.SubgraphMatches(target);
+  BOOST_CHECK_EQUAL(matches.size(), 5);
+  for (const auto& match : matches) {
+    BOOST_CHECK(isValidMapping(pattern, target, match));
+  }
+  BOOST_CHECK_EQUAL(matcher.SubgraphMatches(target, 2).size(), 2);
+
+  // methyl group C with three H
+  Graph methyl =
+      makeMolecule({"C", "H", "H", "H"}, {{0, 1}, {0, 2}, {0, 3}}, 0);
+  GraphMatcher methyl_matcher(methyl);
+  // 3! automorphisms of the hydrogens
+  BOOST_CHECK_EQUAL(methyl_matcher.SubgraphMatches(target).size(), 6);
+  BOOST_CHECK(methyl_matcher.SubgraphMatches(pattern).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -114,4 +114,23 @@ BOOST_AUTO_TEST_CASE(minmax_test) {
   BOOST_CHECK_EQUAL(static_cast<votca::Index>(hn.getMaxBinVal()), 2);
 }
 
+BOOST_AUTO_TEST_CASE(ProcessRange_parallel_test) {
+  // large enough to be binned on the thread pool
+  vector<double> data;
+  for (votca::Index i = 0; i < 300000; ++i) {
+    data.push_back(0.001 * double(i % 12000) - 1.0);
+  }
+  HistogramNew parallel;
+  parallel.Initialize(0.0, 10.0, 21);
+  parallel.ProcessRange(data.begin(), data.end());
+  HistogramNew serial;
+  serial.Initialize(0.0, 10.0, 21);
+  for (double x : data) {
+    serial.Process(x);
+  }
+  for (votca::Index i = 0; i < 21; ++i) {
+    BOOST_CHECK_EQUAL(parallel.data().y(i), serial.data().y(i));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE jobengine_test
+
+// Standard includes
+#include <cstdio>
+#include <fstream>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/jobengine.h"
+
+using namespace votca::tools;
+using votca::Index;
+
+namespace {
+
+class SquareCalculator : public JobCalculator {
+ public:
+  std::string Identify() override { return "square"; }
+  void Initialize(const Property&) override {}
+  bool EvalJob(const Property& input, Property& output) override {
+    double value = input.get("value").as<double>();
+    if (value < 0) {
+      throw std::runtime_error("negative value");
+    }
+    if (value > 1000) {
+      // not derived from std::exception
+      throw value;
+    }
+    output.add("square", std::to_string(value * value));
+    return true;
+  }
+};
+
+Property CreateJobs(Index njobs) {
+  Property root;
+  Property& jobs = root.add("jobs", "");
+  for (Index i = 0; i < njobs; i++) {
+    Property& job = jobs.add("job", "");
+    job.add("id", std::to_string(i + 1));
+    job.add("tag", "job" + std::to_string(i + 1));
+    job.add("input", "").add("value", std::to_string(i));
+    job.add("status", "AVAILABLE");
+  }
+  return root;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(jobengine_test)
+
+BOOST_AUTO_TEST_CASE(run_test) {
+  JobEngine engine(CreateJobs(100));
+  BOOST_CHECK_EQUAL(engine.NumberOfJobs(), 100);
+  Index last_progress = 0;
+  engine.setProgressCallback(
+      [&](Index finished, Index total) {
+        BOOST_CHECK_EQUAL(total, 100);
+        BOOST_CHECK(finished >= last_progress);
+        last_progress = finished;
+      });
+  ThreadPool pool(4);
+  engine.Run([]() { return std::make_unique<SquareCalculator>(); }, pool);
+  BOOST_CHECK_EQUAL(engine.NumberOfCompletedJobs(), 100);
+  BOOST_CHECK_EQUAL(last_progress, 100);
+  for (const Job& job : engine.getJobs()) {
+    double value = double(job.getId() - 1);
+    BOOST_CHECK_CLOSE(job.getOutput().get("square").as<double>(),
+                      value * value, 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(failed_job_test) {
+  Property jobs = CreateJobs(3);
+  jobs.get("jobs").add("job", "");
+  Property& bad = *jobs.Select("jobs.job").back();
+  bad.add("id", "4");
+  bad.add("input", "").add("value", "-1");
+  jobs.get("jobs").add("job", "");
+  Property& unknown = *jobs.Select("jobs.job").back();
+  unknown.add("id", "5");
+  unknown.add("input", "").add("value", "5000");
+
+  JobEngine engine(jobs);
+  engine.Run([]() { return std::make_unique<SquareCalculator>(); });
+  BOOST_CHECK_EQUAL(engine.NumberOfCompletedJobs(), 3);
+  BOOST_CHECK_EQUAL(engine.NumberOfFailedJobs(), 2);
+  BOOST_CHECK_EQUAL(engine.getJobs()[3].getOutput().get("error").value(),
+                    "negative value");
+  BOOST_CHECK_EQUAL(engine.getJobs()[4].getOutput().get("error").value(),
+                    "unknown exception");
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_test) {
+  std::remove("jobs_checkpoint.txt");
+  {
+    std::ofstream checkpoint("jobs_checkpoint.txt");
+    checkpoint << "1\n2\n";
+  }
+  JobEngine engine(CreateJobs(5));
+  engine.setCheckpointFile("jobs_checkpoint.txt");
+  Index evaluated = 0;
+  engine.setProgressCallback(
+      [&](Index finished, Index) { evaluated = finished; });
+  engine.Run([]() { return std::make_unique<SquareCalculator>(); });
+  BOOST_CHECK_EQUAL(evaluated, 3);
+  BOOST_CHECK_EQUAL(engine.NumberOfCompletedJobs(), 5);
+
+  // all jobs are in the checkpoint now, nothing is left to do
+  JobEngine engine2(CreateJobs(5));
+  engine2.setCheckpointFile("jobs_checkpoint.txt");
+  evaluated = 0;
+  engine2.setProgressCallback(
+      [&](Index finished, Index) { evaluated = finished; });
+  engine2.Run([]() { return std::make_unique<SquareCalculator>(); });
+  BOOST_CHECK_EQUAL(evaluated, 0);
+  BOOST_CHECK_EQUAL(engine2.NumberOfCompletedJobs(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(results_test) {
+  JobEngine engine(CreateJobs(4));
+  engine.Run([]() { return std::make_unique<SquareCalculator>(); });
+  engine.WriteResults("jobs_results.xml");
+
+  Property results;
+  results.LoadFromXML("jobs_results.xml");
+  JobEngine reloaded(results);
+  BOOST_CHECK_EQUAL(reloaded.NumberOfJobs(), 4);
+  BOOST_CHECK_EQUAL(reloaded.NumberOfCompletedJobs(), 4);
+  BOOST_CHECK_EQUAL(reloaded.getJobs()[2].getTag(), "job3");
+  BOOST_CHECK_CLOSE(
+      reloaded.getJobs()[2].getOutput().get("square").as<double>(), 4.0,
+      1e-6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
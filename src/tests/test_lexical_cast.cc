@@ -0,0 +1,98 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE lexical_cast_test
+
+// Standard includes
+#include <stdexcept>
+#include <string>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/lexical_cast.h"
+#include "votca/tools/types.h"
+
+using namespace std;
+using namespace votca::tools;
+using votca::Index;
+
+BOOST_AUTO_TEST_SUITE(lexical_cast_test)
+
+BOOST_AUTO_TEST_CASE(converttoken_test) {
+  BOOST_CHECK_EQUAL(ConvertToken<double>("-1.25e-3"), -1.25e-3);
+  BOOST_CHECK_EQUAL(ConvertToken<double>("1e-320") > 0.0, true);
+  BOOST_CHECK_EQUAL(ConvertToken<Index>("-42"), -42);
+  BOOST_CHECK_EQUAL(ConvertToken<unsigned>("42"), 42u);
+  BOOST_CHECK_EQUAL(ConvertToken<int>("2147483647"), 2147483647);
+  BOOST_CHECK_EQUAL(ConvertToken<std::string>("abc"), "abc");
+  BOOST_CHECK_EQUAL(ConvertToken<char>("a"), 'a');
+
+  string longnumber = "1." + string(100, '0') + "1";
+  BOOST_CHECK_CLOSE(ConvertToken<double>(longnumber), 1.0, 1e-10);
+
+  BOOST_CHECK_THROW(ConvertToken<double>(""), boost::bad_lexical_cast);
+  BOOST_CHECK_THROW(ConvertToken<double>(" 1"), boost::bad_lexical_cast);
+  BOOST_CHECK_THROW(ConvertToken<double>("1.0abc"), boost::bad_lexical_cast);
+  BOOST_CHECK_THROW(ConvertToken<double>("1e400"), boost::bad_lexical_cast);
+  BOOST_CHECK_THROW(ConvertToken<int>("2147483648"), boost::bad_lexical_cast);
+  BOOST_CHECK_THROW(ConvertToken<unsigned>("-1"), boost::bad_lexical_cast);
+  BOOST_CHECK_THROW(ConvertToken<Index>("1.5"), boost::bad_lexical_cast);
+
+  // tokens are not terminated, the parser must stop at the token end
+  string numbers = "12345";
+  boost::string_ref prefix = boost::string_ref(numbers).substr(0, 2);
+  BOOST_CHECK_EQUAL(ConvertToken<Index>(prefix), 12);
+}
+
+
+BOOST_AUTO_TEST_CASE(lexical_cast_test) {
+  BOOST_CHECK_EQUAL(lexical_cast<double>(string("2.5"), "error"), 2.5);
+  BOOST_CHECK_EQUAL(lexical_cast<Index>(string("-7"), "error"), -7);
+  BOOST_CHECK_EQUAL(lexical_cast<string>(Index(7), "error"), "7");
+  BOOST_CHECK_EQUAL(lexical_cast<Index>(boost::string_ref("12"), "error"), 12);
+
+  try {
+    lexical_cast<double>(string("2.5x"), "value of a");
+    BOOST_FAIL("conversion should have failed");
+  } catch (std::runtime_error &e) {
+    BOOST_CHECK_EQUAL(string(e.what()), "invaid type: value of a");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(lazy_error_test) {
+  Index calls = 0;
+  auto error = [&calls]() {
+    ++calls;
+    return string("value of b");
+  };
+  BOOST_CHECK_EQUAL(lexical_cast<double>(string("1e3"), error), 1000.0);
+  BOOST_CHECK_EQUAL(calls, 0);
+
+  try {
+    lexical_cast<Index>(string("abc"), error);
+    BOOST_FAIL("conversion should have failed");
+  } catch (std::runtime_error &e) {
+    BOOST_CHECK_EQUAL(string(e.what()), "invaid type: value of b");
+  }
+  BOOST_CHECK_EQUAL(calls, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
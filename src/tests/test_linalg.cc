@@ -20,6 +20,7 @@
 #define BOOST_TEST_MODULE linalg_test
 
 // Standard includes
+#include <cmath>
 #include <iostream>
 
 // Third party includes
@@ -100,4 +101,78 @@ BOOST_AUTO_TEST_CASE(linalg_mkl_test) {
   BOOST_CHECK_EQUAL(check_vector, 1);
 }
 
+BOOST_AUTO_TEST_CASE(linalg_lanczos_test) {
+
+  votca::Index nmax = 4;
+
+  Eigen::MatrixXd H = EigenIO_MatrixMarket::ReadMatrix(
+      std::string(TOOLS_TEST_DATA_FOLDER) + "/linalg/H.mm");
+
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(H);
+  Eigen::VectorXd E_ref = es.eigenvalues().segment(0, nmax);
+
+  EigenSystem result = linalg_lanczos_eigenvalues(DenseOperator(H), nmax);
+  BOOST_CHECK_EQUAL(result.info(), Eigen::Success);
+  BOOST_CHECK(E_ref.isApprox(result.eigenvalues(), 1e-8));
+  Eigen::MatrixXd residual =
+      H * result.eigenvectors() -
+      result.eigenvectors() * result.eigenvalues().asDiagonal();
+  BOOST_CHECK_SMALL(residual.norm(), 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(linalg_lanczos_large_test) {
+
+  votca::Index size = 800;
+  votca::Index nmax = 6;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(size, size);
+  A = (A + A.transpose()).eval();
+  A.diagonal() += Eigen::VectorXd::LinSpaced(size, 0, 50);
+
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(A);
+  Eigen::MatrixXd V_ref = es.eigenvectors().leftCols(nmax);
+  Eigen::VectorXd E_ref = es.eigenvalues().head(nmax);
+
+  EigenSystem result = linalg_lanczos_eigenvalues(DenseOperator(A, 4), nmax);
+  BOOST_CHECK_EQUAL(result.info(), Eigen::Success);
+  BOOST_CHECK(E_ref.isApprox(result.eigenvalues(), 1e-8));
+  BOOST_CHECK(
+      V_ref.cwiseAbs().isApprox(result.eigenvectors().cwiseAbs(), 1e-6));
+
+  // linalg_eigenvalues switches to the partial solver for this size
+  EigenSystem result2 = linalg_eigenvalues(A, nmax);
+  BOOST_CHECK(E_ref.isApprox(result2.eigenvalues(), 1e-8));
+}
+
+// 1D Laplacian with Dirichlet boundaries, never stored as a matrix
+class Laplacian : public MatrixFreeOperator {
+ public:
+  Laplacian(votca::Index size) : _size(size) {}
+  votca::Index size() const final { return _size; }
+  void matmul(const Eigen::VectorXd& x, Eigen::VectorXd& y) const final {
+    for (votca::Index i = 0; i < _size; i++) {
+      y[i] = 2 * x[i];
+      if (i > 0) {
+        y[i] -= x[i - 1];
+      }
+      if (i < _size - 1) {
+        y[i] -= x[i + 1];
+      }
+    }
+  }
+
+ private:
+  votca::Index _size;
+};
+
+BOOST_AUTO_TEST_CASE(linalg_lanczos_matrixfree_test) {
+  votca::Index size = 200;
+  votca::Index nmax = 3;
+  EigenSystem result = linalg_lanczos_eigenvalues(Laplacian(size), nmax);
+  BOOST_CHECK_EQUAL(result.info(), Eigen::Success);
+  for (votca::Index k = 1; k <= nmax; k++) {
+    double ref = 2.0 - 2.0 * std::cos(double(k) * M_PI / double(size + 1));
+    BOOST_CHECK_CLOSE(result.eigenvalues()[k - 1], ref, 1e-6);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
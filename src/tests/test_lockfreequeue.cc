@@ -0,0 +1,93 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE lockfreequeue_test
+
+// Standard includes
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/lockfreequeue.h"
+
+using namespace votca::tools;
+using votca::Index;
+
+BOOST_AUTO_TEST_SUITE(lockfreequeue_test)
+
+BOOST_AUTO_TEST_CASE(push_pop_test) {
+  LockFreeQueue<Index> queue(5);
+  BOOST_CHECK_EQUAL(queue.capacity(), 8);
+  Index value;
+  BOOST_CHECK(!queue.pop(value));
+  for (Index i = 0; i < 8; i++) {
+    BOOST_CHECK(queue.push(i));
+  }
+  BOOST_CHECK(!queue.push(8));
+  for (Index i = 0; i < 8; i++) {
+    BOOST_CHECK(queue.pop(value));
+    BOOST_CHECK_EQUAL(value, i);
+  }
+  BOOST_CHECK(!queue.pop(value));
+  // wrap around
+  BOOST_CHECK(queue.push(42));
+  BOOST_CHECK(queue.pop(value));
+  BOOST_CHECK_EQUAL(value, 42);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_test) {
+  const Index nthreads = 4;
+  const Index nvalues = 10000;
+  LockFreeQueue<Index> queue(64);
+  std::atomic<Index> sum{0};
+  std::atomic<Index> received{0};
+
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < nthreads; t++) {
+    threads.emplace_back([&, t]() {
+      for (Index i = t; i < nvalues; i += nthreads) {
+        while (!queue.push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    threads.emplace_back([&]() {
+      Index value;
+      while (received < nvalues) {
+        if (queue.pop(value)) {
+          sum += value;
+          received++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK_EQUAL(received, nvalues);
+  BOOST_CHECK_EQUAL(sum, nvalues * (nvalues - 1) / 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
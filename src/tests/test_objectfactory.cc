@@ -0,0 +1,208 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE objectfactory_test
+
+// Standard includes
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/objectfactory.h"
+
+using namespace votca::tools;
+using votca::Index;
+
+namespace {
+class Base {
+ public:
+  virtual ~Base() = default;
+  virtual std::string Identify() const = 0;
+  Index uses = 0;
+};
+
+class A : public Base {
+ public:
+  std::string Identify() const override { return "a"; }
+};
+
+class B : public Base {
+ public:
+  std::string Identify() const override { return "b"; }
+};
+
+class Counted : public Base {
+ public:
+  explicit Counted(Index start) { uses = start; }
+  std::string Identify() const override { return "counted"; }
+};
+
+class Shape {
+ public:
+  virtual ~Shape() = default;
+  virtual double Area() const = 0;
+};
+
+class Square : public Shape {
+ public:
+  explicit Square(double side) : _side(side) {}
+  double Area() const override { return _side * _side; }
+
+ private:
+  double _side;
+};
+
+class Rectangle : public Shape {
+ public:
+  explicit Rectangle(double side) : _side(side) {}
+  double Area() const override { return 2 * _side * _side; }
+
+ private:
+  double _side;
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(objectfactory_test)
+
+BOOST_AUTO_TEST_CASE(create_test) {
+  ObjectFactory<std::string, Base> factory;
+  factory.Register<A>("a");
+  factory.Register<B>("b");
+  BOOST_CHECK(factory.IsRegistered("a"));
+  BOOST_CHECK(!factory.IsRegistered("c"));
+  BOOST_CHECK_EQUAL(factory.getObjects().size(), 2);
+
+  std::unique_ptr<Base> raw(factory.Create("a"));
+  BOOST_CHECK_EQUAL(raw->Identify(), "a");
+  std::unique_ptr<Base> unique = factory.CreateUnique("b");
+  BOOST_CHECK_EQUAL(unique->Identify(), "b");
+  BOOST_CHECK_THROW(factory.Create("c"), std::runtime_error);
+
+  factory.Freeze();
+  BOOST_CHECK(factory.IsFrozen());
+  BOOST_CHECK(factory.IsRegistered("b"));
+  BOOST_CHECK(!factory.IsRegistered("c"));
+  BOOST_CHECK(!factory.IsRegistered("0"));
+  BOOST_CHECK_EQUAL(factory.CreateUnique("a")->Identify(), "a");
+  BOOST_CHECK_THROW(factory.Create("z"), std::runtime_error);
+  BOOST_CHECK_THROW(factory.Register<A>("c"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(arguments_test) {
+  ObjectFactory<Index, Shape, double> factory;
+  factory.Register<Square>(1);
+  factory.Register<Rectangle>(2);
+  BOOST_CHECK_EQUAL(factory.CreateUnique(1, 3.0)->Area(), 9.0);
+  BOOST_CHECK_EQUAL(factory.CreateUnique(2, 3.0)->Area(), 18.0);
+}
+
+BOOST_AUTO_TEST_CASE(register_helper_test) {
+  ObjectFactory<std::string, Base> factory;
+  std::string key = "a";
+  ObjectFactoryRegister<A> reg(factory, key);
+  BOOST_CHECK(factory.IsRegistered("a"));
+}
+
+BOOST_AUTO_TEST_CASE(pool_test) {
+  ObjectFactory<std::string, Base> factory;
+  factory.Register<A>("a");
+  factory.Register<B>("b");
+  factory.Freeze();
+
+  ObjectPool<std::string, Base> pool(factory);
+  Base *first = nullptr;
+  {
+    ObjectPool<std::string, Base>::pointer a = pool.Acquire("a");
+    a->uses++;
+    first = a.get();
+    BOOST_CHECK_EQUAL(pool.Available("a"), 0);
+  }
+  BOOST_CHECK_EQUAL(pool.Available("a"), 1);
+  {
+    ObjectPool<std::string, Base>::pointer a = pool.Acquire("a");
+    ObjectPool<std::string, Base>::pointer b = pool.Acquire("b");
+    BOOST_CHECK_EQUAL(a.get(), first);
+    BOOST_CHECK_EQUAL(a->uses, 1);
+    BOOST_CHECK_EQUAL(b->Identify(), "b");
+    ObjectPool<std::string, Base>::pointer a2 = pool.Acquire("a");
+    BOOST_CHECK(a2.get() != first);
+  }
+  BOOST_CHECK_EQUAL(pool.Available("a"), 2);
+  pool.Clear();
+  BOOST_CHECK_EQUAL(pool.Available("a"), 0);
+
+  // objects may outlive the pool
+  ObjectPool<std::string, Base>::pointer survivor;
+  {
+    ObjectPool<std::string, Base> shortlived(factory);
+    survivor = shortlived.Acquire("b");
+  }
+  BOOST_CHECK_EQUAL(survivor->Identify(), "b");
+  survivor.reset();
+}
+
+BOOST_AUTO_TEST_CASE(pool_arguments_test) {
+  ObjectFactory<std::string, Base, Index> factory;
+  factory.Register<Counted>("counted");
+  factory.Freeze();
+
+  ObjectPool<std::string, Base, Index> pool(
+      factory, [](Base &object, Index start) { object.uses = start; });
+  Base *first = nullptr;
+  {
+    ObjectPool<std::string, Base, Index>::pointer c =
+        pool.Acquire("counted", 5);
+    BOOST_CHECK_EQUAL(c->uses, 5);
+    c->uses++;
+    first = c.get();
+  }
+  ObjectPool<std::string, Base, Index>::pointer c = pool.Acquire("counted", 2);
+  BOOST_CHECK_EQUAL(c.get(), first);
+  BOOST_CHECK_EQUAL(c->uses, 2);
+}
+
+BOOST_AUTO_TEST_CASE(pool_threads_test) {
+  ObjectFactory<std::string, Base> factory;
+  factory.Register<A>("a");
+  factory.Freeze();
+  ObjectPool<std::string, Base> pool(factory);
+
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < 4; ++t) {
+    threads.emplace_back([&pool]() {
+      for (Index i = 0; i < 1000; ++i) {
+        ObjectPool<std::string, Base>::pointer a = pool.Acquire("a");
+        a->uses++;
+      }
+    });
+  }
+  for (std::thread &t : threads) {
+    t.join();
+  }
+  BOOST_CHECK(pool.Available("a") >= 1);
+  BOOST_CHECK(pool.Available("a") <= 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE optionsbinder_test
+
+// Standard includes
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/optionsbinder.h"
+
+using namespace std;
+using namespace votca::tools;
+using votca::Index;
+
+namespace {
+struct TestOptions {
+  double cutoff = 0.0;
+  Index steps = 0;
+  string method;
+  bool verbose = false;
+  vector<double> weights;
+  string nested;
+};
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(optionsbinder_test)
+
+BOOST_AUTO_TEST_CASE(parse_test) {
+  Property options;
+  options.add("cutoff", "1.5");
+  options.add("steps", "20");
+  options.add("method", "lanczos");
+  options.add("weights", "1.0, 2.0 3.0");
+  options.add("group", "").add("nested", "inner");
+
+  OptionsBinder<TestOptions> binder;
+  binder.Bind("cutoff", &TestOptions::cutoff)
+      .Bind("method", &TestOptions::method)
+      .Bind("verbose", &TestOptions::verbose, true)
+      .Bind("weights", &TestOptions::weights)
+      .Bind("group.nested", &TestOptions::nested);
+  BOOST_CHECK_EQUAL(binder.Keys().size(), 5);
+
+  TestOptions opt = binder.Parse(options);
+  BOOST_CHECK_EQUAL(opt.cutoff, 1.5);
+  BOOST_CHECK_EQUAL(opt.method, "lanczos");
+  BOOST_CHECK_EQUAL(opt.verbose, true);
+  BOOST_REQUIRE_EQUAL(opt.weights.size(), 3);
+  BOOST_CHECK_EQUAL(opt.weights[2], 3.0);
+  BOOST_CHECK_EQUAL(opt.nested, "inner");
+  BOOST_CHECK_EQUAL(opt.steps, 0);
+}
+
+BOOST_AUTO_TEST_CASE(default_test) {
+  Property options;
+  options.add("steps", "7");
+
+  // defaults only have to be convertible to the type of the member
+  OptionsBinder<TestOptions> binder;
+  binder.Bind("cutoff", &TestOptions::cutoff, 2)
+      .Bind("steps", &TestOptions::steps, 3)
+      .Bind("method", &TestOptions::method, "power");
+
+  TestOptions opt = binder.Parse(options);
+  BOOST_CHECK_EQUAL(opt.cutoff, 2.0);
+  BOOST_CHECK_EQUAL(opt.steps, 7);
+  BOOST_CHECK_EQUAL(opt.method, "power");
+}
+
+BOOST_AUTO_TEST_CASE(error_test) {
+  Property options;
+  options.add("cutoff", "far");
+
+  OptionsBinder<TestOptions> binder;
+  binder.Bind("cutoff", &TestOptions::cutoff);
+  BOOST_CHECK_THROW(binder.Parse(options), std::runtime_error);
+
+  OptionsBinder<TestOptions> missing;
+  missing.Bind("steps", &TestOptions::steps);
+  BOOST_CHECK_THROW(missing.Parse(options), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(check_keys_test) {
+  Property options;
+  options.add("cutoff", "1.5");
+  options.add("group", "").add("nested", "inner");
+
+  OptionsBinder<TestOptions> binder;
+  binder.Bind("cutoff", &TestOptions::cutoff)
+      .Bind("group.nested", &TestOptions::nested);
+  BOOST_CHECK_NO_THROW(binder.CheckKeys(options));
+
+  // a misspelled key with a default would never be read
+  binder.Bind("stpes", &TestOptions::steps, 3);
+  BOOST_CHECK_THROW(binder.CheckKeys(options), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
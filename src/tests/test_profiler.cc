@@ -0,0 +1,169 @@
+/*
+ *            Copyright 2009-2020 The VOTCA Development Team
+ *                       (http://www.votca.org)
+ *
+ *      Licensed under the Apache License, Version 2.0 (the "License")
+ *
+ * You may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *              http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE profiler_test
+
+// Standard includes
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/histogramnew.h"
+#include "votca/tools/profiler.h"
+#include "votca/tools/threadpool.h"
+
+using namespace std;
+using namespace votca::tools;
+
+namespace {
+void inner() { ScopedRegion region("inner"); }
+
+void outer() {
+  ScopedRegion region("outer");
+  inner();
+  inner();
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(profiler_test)
+
+BOOST_AUTO_TEST_CASE(disabled_test) {
+  Profiler& profiler = Profiler::Global();
+  profiler.Disable();
+  profiler.Reset();
+  outer();
+  BOOST_CHECK(profiler.getRegions().empty());
+}
+
+BOOST_AUTO_TEST_CASE(nested_regions_test) {
+  Profiler& profiler = Profiler::Global();
+  profiler.Reset();
+  profiler.Enable();
+  outer();
+  outer();
+  inner();
+  profiler.Disable();
+
+  vector<Profiler::Region> regions = profiler.getRegions();
+  BOOST_REQUIRE_EQUAL(regions.size(), 3);
+  // parents come before their children
+  BOOST_CHECK_EQUAL(regions[0].path.size(), 1);
+  BOOST_CHECK_EQUAL(regions[0].path[0], "inner");
+  BOOST_CHECK_EQUAL(regions[0].calls, 1);
+  BOOST_CHECK_EQUAL(regions[1].path.size(), 1);
+  BOOST_CHECK_EQUAL(regions[1].path[0], "outer");
+  BOOST_CHECK_EQUAL(regions[1].calls, 2);
+  BOOST_CHECK_EQUAL(regions[2].path.size(), 2);
+  BOOST_CHECK_EQUAL(regions[2].path[0], "outer");
+  BOOST_CHECK_EQUAL(regions[2].path[1], "inner");
+  BOOST_CHECK_EQUAL(regions[2].calls, 4);
+
+  BOOST_CHECK(regions[1].total >= regions[2].total);
+  BOOST_CHECK(regions[2].min <= regions[2].max);
+
+  stringstream summary;
+  profiler.WriteSummary(summary);
+  BOOST_CHECK(summary.str().find("  inner") != string::npos);
+
+  profiler.Reset();
+  BOOST_CHECK(profiler.getRegions().empty());
+}
+
+BOOST_AUTO_TEST_CASE(threads_test) {
+  Profiler& profiler = Profiler::Global();
+  profiler.Reset();
+  profiler.Enable();
+  vector<thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([]() {
+      for (int j = 0; j < 100; j++) {
+        outer();
+        Profiler::Global().Count("calls", 2);
+      }
+    });
+  }
+  for (thread& t : threads) {
+    t.join();
+  }
+  profiler.Disable();
+
+  // every thread has its own tree, they are merged by path
+  vector<Profiler::Region> regions = profiler.getRegions();
+  BOOST_REQUIRE_EQUAL(regions.size(), 2);
+  BOOST_CHECK_EQUAL(regions[0].calls, 400);
+  BOOST_CHECK_EQUAL(regions[1].calls, 800);
+
+  vector<Profiler::Counter> counters = profiler.getCounters();
+  BOOST_REQUIRE_EQUAL(counters.size(), 1);
+  BOOST_CHECK_EQUAL(counters[0].name, "calls");
+  BOOST_CHECK_EQUAL(counters[0].value, 800);
+}
+
+BOOST_AUTO_TEST_CASE(chrome_trace_test) {
+  Profiler& profiler = Profiler::Global();
+  profiler.Reset();
+  profiler.Enable(true, 2);
+  outer();
+  profiler.Count("items", 5);
+  profiler.Disable();
+
+  stringstream trace;
+  profiler.WriteChromeTrace(trace);
+  string json = trace.str();
+  BOOST_CHECK_EQUAL(json.find("{\"traceEvents\":["), 0);
+  BOOST_CHECK(json.find("\"name\":\"inner\",\"cat\":\"votca\",\"ph\":\"X\"") !=
+              string::npos);
+  // the limit of two events per thread drops the outer region
+  BOOST_CHECK(json.find("\"name\":\"outer\"") == string::npos);
+  BOOST_CHECK(json.find("\"dropped_events\":1") != string::npos);
+  BOOST_CHECK(json.find("\"items\":5") != string::npos);
+  profiler.Reset();
+}
+
+BOOST_AUTO_TEST_CASE(library_regions_test) {
+  Profiler& profiler = Profiler::Global();
+  profiler.Reset();
+  profiler.Enable();
+  HistogramNew hist;
+  hist.Initialize(0.0, 1.0, 10);
+  vector<double> values = {0.1, 0.2, 0.3};
+  hist.ProcessRange<vector<double>::iterator>(values.begin(), values.end());
+  profiler.Disable();
+
+  vector<Profiler::Region> regions = profiler.getRegions();
+  vector<Profiler::Counter> counters = profiler.getCounters();
+  if (Profiler::CompiledIn()) {
+    BOOST_REQUIRE_EQUAL(regions.size(), 1);
+    BOOST_CHECK_EQUAL(regions[0].path[0], "HistogramNew::ProcessRange");
+    BOOST_REQUIRE_EQUAL(counters.size(), 1);
+    BOOST_CHECK_EQUAL(counters[0].value, 3);
+  } else {
+    BOOST_CHECK(regions.empty());
+    BOOST_CHECK(counters.empty());
+  }
+  profiler.Reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
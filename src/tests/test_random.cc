@@ -20,7 +20,9 @@
 #define BOOST_TEST_MODULE random2_test
 
 // Standard includes
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 #include <string>
 
 // Third party includes
@@ -29,9 +31,11 @@
 
 // Local VOTCA includes
 #include "votca/tools/random.h"
+#include "votca/tools/threadpool.h"
 
 using namespace std;
 using namespace votca::tools;
+using votca::Index;
 
 BOOST_AUTO_TEST_SUITE(random2_test)
 
@@ -72,4 +76,98 @@ BOOST_AUTO_TEST_CASE(random_double_test) {
   BOOST_CHECK_CLOSE(average, 0.5, 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(philox_known_answer_test) {
+  // known answer vectors of the Random123 reference implementation
+  Philox4x32 zero(0, 0);
+  Philox4x32::Block block = zero.Generate(0);
+  BOOST_CHECK_EQUAL(block[0], 0x6627e8d5u);
+  BOOST_CHECK_EQUAL(block[1], 0xe169c58du);
+  BOOST_CHECK_EQUAL(block[2], 0xbc57ac4cu);
+  BOOST_CHECK_EQUAL(block[3], 0x9b00dbd8u);
+
+  Philox4x32 ones(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+  block = ones.Generate(0xFFFFFFFFFFFFFFFFull);
+  BOOST_CHECK_EQUAL(block[0], 0x408f276du);
+  BOOST_CHECK_EQUAL(block[1], 0x41c83b0eu);
+  BOOST_CHECK_EQUAL(block[2], 0xa20bc7c6u);
+  BOOST_CHECK_EQUAL(block[3], 0x6d5451fdu);
+
+  // sequential output and discard agree with the blocks
+  Philox4x32 engine(5, 7);
+  Philox4x32 skipped = engine;
+  skipped.discard(6);
+  for (Index i = 0; i < 6; ++i) {
+    engine();
+  }
+  BOOST_CHECK(engine == skipped);
+  BOOST_CHECK_EQUAL(engine(), engine.Generate(1)[2]);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_random_test) {
+  ParallelRandom random;
+  random.init(1);
+  Index number = 100000;
+  double sum = 0.0;
+  double sum2 = 0.0;
+  for (Index i = 0; i < number; i++) {
+    double x = random.rand_normal();
+    sum += x;
+    sum2 += x * x;
+  }
+  BOOST_CHECK_SMALL(sum / double(number), 0.02);
+  BOOST_CHECK_CLOSE(sum2 / double(number), 1.0, 2.0);
+
+  random.setMaxInt(50);
+  std::vector<Index> results;
+  for (Index i = 0; i < number; i++) {
+    results.push_back(random.rand_uniform_int());
+  }
+  double average = std::accumulate(results.begin(), results.end(), 0);
+  average /= double(number);
+  BOOST_CHECK_CLOSE(average, 25, 1.0);
+  BOOST_CHECK_EQUAL(*std::max_element(results.begin(), results.end()), 50);
+
+  // substreams are reproducible and differ from each other
+  ParallelRandom a = random.Substream(3);
+  ParallelRandom b = random.Substream(3);
+  ParallelRandom c = random.Substream(4);
+  double xa = a.rand_uniform();
+  BOOST_CHECK_EQUAL(xa, b.rand_uniform());
+  BOOST_CHECK(xa != c.rand_uniform());
+}
+
+BOOST_AUTO_TEST_CASE(fill_test) {
+  Index size = 200001;
+  ParallelRandom random;
+  random.init(7);
+
+  ThreadPool::Global().Resize(1);
+  Eigen::VectorXd serial(size);
+  ParallelRandom first = random;
+  first.FillUniform(serial);
+
+  ThreadPool::Global().Resize(4);
+  Eigen::VectorXd parallel(size);
+  ParallelRandom second = random;
+  second.FillUniform(parallel);
+  BOOST_CHECK(serial == parallel);
+  BOOST_CHECK(first.getEngine() == second.getEngine());
+  BOOST_CHECK_CLOSE(parallel.mean(), 0.5, 1.0);
+  BOOST_CHECK(parallel.minCoeff() >= 0.0);
+  BOOST_CHECK(parallel.maxCoeff() < 1.0);
+
+  Eigen::ArrayXXd normal(500, 400);
+  random.FillNormal(normal);
+  BOOST_CHECK_SMALL(normal.mean(), 0.01);
+  BOOST_CHECK_CLOSE((normal * normal).mean(), 1.0, 2.0);
+
+  // blocks are filled through a temporary
+  Eigen::MatrixXd m = Eigen::MatrixXd::Zero(4, 4);
+  random.FillUniform(m.block(1, 1, 2, 2));
+  BOOST_CHECK_EQUAL(m(0, 0), 0.0);
+  BOOST_CHECK(m(1, 1) > 0.0);
+  BOOST_CHECK(m(2, 2) > 0.0);
+  ThreadPool::Global().Resize(1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
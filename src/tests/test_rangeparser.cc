@@ -0,0 +1,93 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE rangeparser_test
+
+// Standard includes
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/rangeparser.h"
+
+using namespace votca::tools;
+using votca::Index;
+
+BOOST_AUTO_TEST_SUITE(rangeparser_test)
+
+BOOST_AUTO_TEST_CASE(parse_test) {
+  RangeParser rp;
+  rp.Parse("1:3, 10:5:20,2");
+
+  std::vector<Index> values;
+  for (Index i : rp) {
+    values.push_back(i);
+  }
+  std::vector<Index> reference = {1, 2, 3, 10, 15, 20, 2};
+  BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(),
+                                reference.begin(), reference.end());
+
+  std::stringstream out;
+  out << rp;
+  BOOST_CHECK_EQUAL(out.str(), "1:3,10:5:20,2");
+
+  BOOST_CHECK_EQUAL(rp.size(), 6);
+  BOOST_CHECK(rp.contains(15));
+  BOOST_CHECK(!rp.contains(11));
+
+  rp.Add(100, 200);
+  BOOST_CHECK(rp.contains(150));
+  BOOST_CHECK_EQUAL(rp.size(), 107);
+
+  RangeParser invalid;
+  BOOST_CHECK_THROW(invalid.Parse("5:1"), std::runtime_error);
+  BOOST_CHECK_THROW(invalid.Parse("1:2:3:4"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_query_test) {
+  RangeParser rp;
+  for (Index i = 0; i < 1000; i++) {
+    rp.Add(10 * i, 10 * i + 4);
+  }
+  // the first queries compile the set, several threads may run them at once
+  const RangeParser &shared = rp;
+  std::vector<std::thread> threads;
+  std::vector<Index> found(4, 0);
+  for (Index t = 0; t < 4; t++) {
+    threads.emplace_back([&shared, &found, t]() {
+      for (Index value = 0; value < 10000; value++) {
+        found[t] += shared.contains(value);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (Index count : found) {
+    BOOST_CHECK_EQUAL(count, 5000);
+  }
+  RangeParser copy = rp;
+  BOOST_CHECK_EQUAL(copy.size(), 5000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE rangeset_test
+
+// Standard includes
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/rangeset.h"
+
+using namespace votca::tools;
+using votca::Index;
+
+namespace {
+std::set<Index> Expand(const std::vector<RangeSet::Block> &blocks) {
+  std::set<Index> result;
+  for (const RangeSet::Block &b : blocks) {
+    for (Index x = b.begin; x <= b.end; x += b.stride) {
+      result.insert(x);
+    }
+  }
+  return result;
+}
+
+void CheckEqual(const RangeSet &set, const std::set<Index> &reference,
+                Index lower, Index upper) {
+  BOOST_CHECK_EQUAL(set.size(), Index(reference.size()));
+  std::vector<Index> values = set.ToVector();
+  BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(),
+                                reference.begin(), reference.end());
+  for (Index x = lower; x <= upper; ++x) {
+    BOOST_CHECK_EQUAL(set.contains(x), reference.count(x) == 1);
+  }
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(rangeset_test)
+
+BOOST_AUTO_TEST_CASE(merge_test) {
+  std::vector<RangeSet::Block> blocks = {
+      {1, 10, 1}, {5, 20, 1}, {21, 30, 1}, {40, 40, 1}};
+  RangeSet set(blocks);
+  BOOST_CHECK_EQUAL(set.size(), 31);
+  BOOST_CHECK_EQUAL(set.Blocks().size(), 2);
+  CheckEqual(set, Expand(blocks), -5, 50);
+
+  RangeSet empty;
+  BOOST_CHECK(empty.empty());
+  BOOST_CHECK(!empty.contains(0));
+  BOOST_CHECK(RangeSet({{5, 1, 1}}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(stride_test) {
+  std::vector<RangeSet::Block> blocks = {
+      {1, 1000000, 10}, {5000, 6000, 1}, {0, 100, 3}};
+  RangeSet set(blocks);
+  BOOST_CHECK(set.contains(1));
+  BOOST_CHECK(set.contains(999991));
+  BOOST_CHECK(!set.contains(1000001));
+  BOOST_CHECK(set.contains(5555));
+  BOOST_CHECK(!set.contains(6005));
+  BOOST_CHECK(set.contains(6011));
+  BOOST_CHECK_EQUAL(set.size(), Index(Expand(blocks).size()));
+
+  // negative strides count down from begin
+  RangeSet down({{10, 1, -3}});
+  std::vector<Index> values = down.ToVector();
+  std::vector<Index> reference = {1, 4, 7, 10};
+  BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(),
+                                reference.begin(), reference.end());
+}
+
+BOOST_AUTO_TEST_CASE(random_test) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<Index> pos(0, 200);
+  std::uniform_int_distribution<Index> stride(1, 7);
+  std::uniform_int_distribution<Index> count(1, 6);
+  for (Index trial = 0; trial < 50; ++trial) {
+    std::vector<RangeSet::Block> a, b;
+    for (Index i = count(gen); i > 0; --i) {
+      Index begin = pos(gen);
+      a.push_back({begin, begin + pos(gen), stride(gen)});
+    }
+    for (Index i = count(gen); i > 0; --i) {
+      Index begin = pos(gen);
+      b.push_back({begin, begin + pos(gen), stride(gen)});
+    }
+    std::set<Index> ref_a = Expand(a);
+    std::set<Index> ref_b = Expand(b);
+    RangeSet set_a(a), set_b(b);
+    CheckEqual(set_a, ref_a, -1, 402);
+
+    std::set<Index> ref_union = ref_a;
+    ref_union.insert(ref_b.begin(), ref_b.end());
+    CheckEqual(set_a.Union(set_b), ref_union, -1, 402);
+
+    std::set<Index> ref_intersection;
+    std::set_intersection(
+        ref_a.begin(), ref_a.end(), ref_b.begin(), ref_b.end(),
+        std::inserter(ref_intersection, ref_intersection.begin()));
+    CheckEqual(set_a.Intersect(set_b), ref_intersection, -1, 402);
+
+    // the blocks reproduce the set
+    CheckEqual(RangeSet(set_a.Blocks()), ref_a, -1, 402);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(mask_test) {
+  RangeSet set({{-4, 4, 2}, {8, 20, 4}});
+  std::vector<bool> mask = set.ToMask(13);
+  BOOST_REQUIRE_EQUAL(mask.size(), 13);
+  for (Index i = 0; i < 13; ++i) {
+    BOOST_CHECK_EQUAL(mask[i], set.contains(i));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -162,4 +162,17 @@ BOOST_AUTO_TEST_CASE(hash_key_test) {
   e_map[2] = ed;
 }
 
+BOOST_AUTO_TEST_CASE(getedge_test) {
+  ReducedEdge ed(vector<votca::Index>{4, 1, 6, 7, 0});
+  BOOST_CHECK(ed.getEdge() == Edge(0, 4));
+  BOOST_CHECK(ed.contains(4));
+  BOOST_CHECK(ed.contains(6) == false);
+  BOOST_CHECK_EQUAL(ed.getOtherEndPoint(0), 4);
+  BOOST_CHECK(ed.loop() == false);
+
+  ReducedEdge ed2(vector<votca::Index>{2, 4, 1, 2});
+  BOOST_CHECK(ed2.loop());
+  BOOST_CHECK(ed2.getEdge() == Edge(1, 1));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -794,4 +794,41 @@ BOOST_AUTO_TEST_CASE(id_test) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(duplicate_chain_test) {
+  // 1 - 2 - 3
+  // |       |
+  // 4 - - - 5
+  // given twice, the duplicate must not be stored again
+  vector<ReducedEdge> vec_ed;
+  vec_ed.push_back(ReducedEdge(vector<votca::Index>{1, 2, 3}));
+  vec_ed.push_back(ReducedEdge(vector<votca::Index>{1, 4, 5, 3}));
+  vec_ed.push_back(ReducedEdge(vector<votca::Index>{1, 2, 3}));
+  vec_ed.push_back(ReducedEdge(vector<votca::Index>{3, 5, 4, 1}));
+
+  ReducedGraph g(vec_ed);
+  vector<vector<Edge>> chains = g.expandEdge(Edge(1, 3));
+  BOOST_REQUIRE_EQUAL(chains.size(), 2);
+  BOOST_CHECK_EQUAL(chains.at(0).size(), 2);
+  BOOST_CHECK_EQUAL(chains.at(1).size(), 3);
+
+  Graph full = g.expandGraph();
+  BOOST_CHECK_EQUAL(full.getEdges().size(), 5);
+  BOOST_CHECK_EQUAL(full.getVertices().size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(long_chain_test) {
+  // a linear chain is reduced to a single edge between its tips
+  votca::Index length = 10000;
+  vector<votca::Index> chain(length);
+  for (votca::Index i = 0; i < length; ++i) {
+    chain[i] = i;
+  }
+  ReducedGraph g(vector<ReducedEdge>{ReducedEdge(chain)});
+  BOOST_CHECK_EQUAL(g.getEdges().size(), 1);
+  vector<vector<Edge>> chains = g.expandEdge(Edge(0, length - 1));
+  BOOST_REQUIRE_EQUAL(chains.size(), 1);
+  BOOST_CHECK_EQUAL(chains.at(0).size(), length - 1);
+  BOOST_CHECK_EQUAL(chains.at(0).back(), Edge(length - 2, length - 1));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
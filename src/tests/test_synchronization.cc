@@ -0,0 +1,145 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE synchronization_test
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/synchronization.h"
+
+using namespace votca::tools;
+using votca::Index;
+
+namespace {
+template <class F>
+void RunThreads(Index nthreads, F f) {
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < nthreads; t++) {
+    threads.emplace_back(f);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(synchronization_test)
+
+BOOST_AUTO_TEST_CASE(scopedlock_test) {
+  Mutex mutex;
+  Index counter = 0;
+  RunThreads(4, [&]() {
+    for (Index i = 0; i < 10000; i++) {
+      ScopedLock<Mutex> lock(mutex);
+      counter++;
+    }
+  });
+  BOOST_CHECK_EQUAL(counter, 40000);
+  BOOST_CHECK(mutex.try_lock());
+  BOOST_CHECK(!mutex.try_lock());
+  mutex.unlock();
+}
+
+BOOST_AUTO_TEST_CASE(hybridlock_test) {
+  HybridLock lock;
+  Index counter = 0;
+  RunThreads(8, [&]() {
+    for (Index i = 0; i < 10000; i++) {
+      ScopedLock<HybridLock> guard(lock);
+      counter++;
+    }
+  });
+  BOOST_CHECK_EQUAL(counter, 80000);
+
+  // long critical sections make the waiting threads sleep
+  RunThreads(4, [&]() {
+    for (Index i = 0; i < 5; i++) {
+      std::lock_guard<HybridLock> guard(lock);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      counter++;
+    }
+  });
+  BOOST_CHECK_EQUAL(counter, 80020);
+}
+
+BOOST_AUTO_TEST_CASE(readwritelock_test) {
+  ReadWriteLock lock;
+  std::vector<Index> data(100, 0);
+  std::atomic<bool> consistent{true};
+  RunThreads(4, [&]() {
+    for (Index i = 0; i < 1000; i++) {
+      if (i % 10 == 0) {
+        WriteLock write(lock);
+        for (Index& d : data) {
+          d++;
+        }
+      } else {
+        ReadLock read(lock);
+        // readers never see a half written update
+        if (data.front() != data.back()) {
+          consistent = false;
+        }
+      }
+    }
+  });
+  BOOST_CHECK(consistent);
+  BOOST_CHECK_EQUAL(data.front(), 400);
+}
+
+BOOST_AUTO_TEST_CASE(shardedcounter_test) {
+  ShardedCounter counter(4);
+  RunThreads(8, [&]() {
+    for (Index i = 0; i < 10000; i++) {
+      counter.add();
+    }
+  });
+  BOOST_CHECK_EQUAL(counter.value(), 80000);
+  counter.reset();
+  BOOST_CHECK_EQUAL(counter.value(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(shardedaccumulator_test) {
+  ShardedAccumulator<double> sum(0.0);
+  RunThreads(4, [&]() {
+    for (Index i = 0; i < 1000; i++) {
+      sum.add(0.5);
+    }
+  });
+  BOOST_CHECK_CLOSE(sum.value(), 2000.0, 1e-10);
+
+  ShardedAccumulator<Index> max(
+      0, [](const Index& a, const Index& b) { return std::max(a, b); });
+  RunThreads(4, [&]() {
+    for (Index i = 0; i < 1000; i++) {
+      max.add(i);
+    }
+  });
+  BOOST_CHECK_EQUAL(max.value(), 999);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
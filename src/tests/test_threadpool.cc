@@ -0,0 +1,195 @@
+/*
+ * Copyright 2009-2020 The VOTCA Development Team (http://www.votca.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#define BOOST_TEST_MODULE threadpool_test
+
+// Standard includes
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Third party includes
+#include <boost/test/unit_test.hpp>
+
+// Local VOTCA includes
+#include "votca/tools/threadpool.h"
+
+using namespace votca::tools;
+using votca::Index;
+
+BOOST_AUTO_TEST_SUITE(threadpool_test)
+
+BOOST_AUTO_TEST_CASE(submit_test) {
+  ThreadPool pool(4);
+  BOOST_CHECK_EQUAL(pool.size(), 4);
+  std::vector<std::future<Index>> results;
+  for (Index i = 0; i < 100; i++) {
+    results.push_back(pool.submit([i]() { return i * i; }));
+  }
+  for (Index i = 0; i < 100; i++) {
+    BOOST_CHECK_EQUAL(results[i].get(), i * i);
+  }
+
+  // without workers tasks are executed right away
+  ThreadPool serial(1);
+  std::future<Index> result = serial.submit([]() { return Index(3); });
+  BOOST_CHECK_EQUAL(result.get(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_for_test) {
+  ThreadPool pool(3);
+  std::vector<Index> values(1000, 0);
+  pool.parallel_for(0, 1000, [&](Index i) { values[i] = 2 * i; });
+  for (Index i = 0; i < 1000; i++) {
+    BOOST_CHECK_EQUAL(values[i], 2 * i);
+  }
+
+  std::atomic<Index> count{0};
+  pool.parallel_for(10, 20, [&](Index) { count++; }, 3);
+  BOOST_CHECK_EQUAL(count, 10);
+
+  // empty ranges do nothing
+  pool.parallel_for(5, 5, [&](Index) { count++; });
+  BOOST_CHECK_EQUAL(count, 10);
+}
+
+BOOST_AUTO_TEST_CASE(nested_parallel_for_test) {
+  ThreadPool pool(2);
+  std::atomic<Index> count{0};
+  pool.parallel_for(0, 10, [&](Index) {
+    pool.parallel_for(0, 10, [&](Index) { count++; });
+  });
+  BOOST_CHECK_EQUAL(count, 100);
+}
+
+BOOST_AUTO_TEST_CASE(exception_test) {
+  ThreadPool pool(4);
+  BOOST_CHECK_THROW(pool.parallel_for(0, 100,
+                                      [](Index i) {
+                                        if (i == 42) {
+                                          throw std::runtime_error("42");
+                                        }
+                                      }),
+                    std::runtime_error);
+  std::future<void> result =
+      pool.submit([]() { throw std::runtime_error("fail"); });
+  BOOST_CHECK_THROW(result.get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(workerlocal_test) {
+  ThreadPool pool(4);
+  WorkerLocal<Index> sums(pool, 0);
+  pool.parallel_for(0, 1001, [&](Index i) { sums.local() += i; });
+  Index total = std::accumulate(sums.begin(), sums.end(), Index(0));
+  BOOST_CHECK_EQUAL(total, 500500);
+  BOOST_CHECK_EQUAL(pool.WorkerIndex(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_callers_test) {
+  // every caller outside of the pool has WorkerIndex() 0, each of them must
+  // only ever run chunks of its own parallel_for
+  ThreadPool pool(4);
+  std::atomic<Index> errors{0};
+  std::vector<std::thread> callers;
+  for (Index c = 0; c < 3; c++) {
+    callers.emplace_back([&]() {
+      for (Index repeat = 0; repeat < 50; repeat++) {
+        WorkerLocal<Index> current(pool, -1);
+        pool.parallel_for(
+            0, 200,
+            [&](Index i) {
+              Index& slot = current.local();
+              slot = i;
+              for (Index k = 0; k < 200; k++) {
+                if (slot != i) {
+                  errors++;
+                  return;
+                }
+                std::this_thread::yield();
+              }
+            },
+            1);
+      }
+    });
+  }
+  for (std::thread& caller : callers) {
+    caller.join();
+  }
+  BOOST_CHECK_EQUAL(errors, 0);
+}
+
+BOOST_AUTO_TEST_CASE(nested_workerlocal_test) {
+  // a nested parallel_for must not run chunks of the outer region on the
+  // waiting thread, which would reuse the outer scratch entry
+  ThreadPool pool(3);
+  WorkerLocal<Index> current(pool, -1);
+  std::atomic<Index> errors{0};
+  pool.parallel_for(
+      0, 30,
+      [&](Index i) {
+        current.local() = i;
+        std::atomic<Index> inner{0};
+        pool.parallel_for(0, 20, [&](Index) { inner++; }, 1);
+        if (current.local() != i || inner != 20) {
+          errors++;
+        }
+      },
+      1);
+  BOOST_CHECK_EQUAL(errors, 0);
+}
+
+BOOST_AUTO_TEST_CASE(max_threads_test) {
+  ThreadPool pool(4);
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  pool.parallel_for(
+      0, 1000,
+      [&](Index) {
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+      },
+      1, 2);
+  BOOST_CHECK(threads.size() <= 2);
+  BOOST_CHECK_EQUAL(pool.size(), 4);
+
+  threads.clear();
+  pool.parallel_for(
+      0, 1000, [&](Index) { threads.insert(std::this_thread::get_id()); }, 0,
+      1);
+  BOOST_CHECK_EQUAL(threads.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(resize_test) {
+  ThreadPool pool(2);
+  pool.Resize(5);
+  BOOST_CHECK_EQUAL(pool.size(), 5);
+  std::atomic<Index> count{0};
+  pool.parallel_for(0, 100, [&](Index) { count++; });
+  BOOST_CHECK_EQUAL(count, 100);
+  pool.Resize(1);
+  BOOST_CHECK_EQUAL(pool.size(), 1);
+  pool.parallel_for(0, 100, [&](Index) { count++; });
+  BOOST_CHECK_EQUAL(count, 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -28,9 +28,11 @@
 
 // Local VOTCA includes
 #include "votca/tools/tokenizer.h"
+#include "votca/tools/types.h"
 
 using namespace std;
 using namespace votca::tools;
+using votca::Index;
 
 BOOST_AUTO_TEST_SUITE(tokenizer_test)
 
@@ -62,6 +64,69 @@ BOOST_AUTO_TEST_CASE(tokenizer_test) {
   BOOST_CHECK_EQUAL(result3[0], "hello");
 }
 
+BOOST_AUTO_TEST_CASE(tokenizer_collapse_test) {
+  Tokenizer tok(",,a, b,,c ,", " ,");
+  std::vector<std::string> result = tok.ToVector();
+  BOOST_REQUIRE_EQUAL(result.size(), 3);
+  BOOST_CHECK_EQUAL(result[0], "a");
+  BOOST_CHECK_EQUAL(result[1], "b");
+  BOOST_CHECK_EQUAL(result[2], "c");
+
+  Tokenizer copy = tok;
+  BOOST_CHECK_EQUAL(copy.ToVector().size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(tokenizer_convert_test) {
+  Tokenizer tok("1.5 -2 3e2", " ");
+  std::vector<double> values = {7.0, 8.0, 9.0, 10.0};
+  tok.ConvertToVector(values);
+  BOOST_REQUIRE_EQUAL(values.size(), 3);
+  BOOST_CHECK_EQUAL(values[0], 1.5);
+  BOOST_CHECK_EQUAL(values[1], -2.0);
+  BOOST_CHECK_EQUAL(values[2], 300.0);
+
+  std::vector<Index> ints;
+  Tokenizer("4,-5,6", ",").ConvertToVector(ints);
+  BOOST_REQUIRE_EQUAL(ints.size(), 3);
+  BOOST_CHECK_EQUAL(ints[1], -5);
+
+  std::vector<bool> flags;
+  Tokenizer("1 0", " ").ConvertToVector(flags);
+  BOOST_CHECK_EQUAL(flags[0], true);
+  BOOST_CHECK_EQUAL(flags[1], false);
+
+  BOOST_CHECK_THROW(Tokenizer("1.5 x", " ").ConvertToVector(values),
+                    boost::bad_lexical_cast);
+  BOOST_CHECK_THROW(Tokenizer("1.5", " ").ConvertToVector(ints),
+                    boost::bad_lexical_cast);
+}
+
+BOOST_AUTO_TEST_CASE(tokenizerview_test) {
+  string line = "\t 1.0  2.0\t u ";
+  TokenizerView view(line, " \t");
+  std::vector<boost::string_ref> tokens;
+  view.ToVector(tokens);
+  BOOST_REQUIRE_EQUAL(tokens.size(), 3);
+  BOOST_CHECK_EQUAL(tokens[0], "1.0");
+  BOOST_CHECK_EQUAL(tokens[1], "2.0");
+  BOOST_CHECK_EQUAL(tokens[2], "u");
+  // tokens point into the original buffer
+  BOOST_CHECK(tokens[0].data() == line.data() + 2);
+
+  Index count = 0;
+  for (boost::string_ref token : TokenizerView("a.b.c", ".")) {
+    BOOST_CHECK_EQUAL(token.size(), 1);
+    ++count;
+  }
+  BOOST_CHECK_EQUAL(count, 3);
+
+  TokenizerView empty("   ", " ");
+  BOOST_CHECK(empty.begin() == empty.end());
+
+  TokenizerView noseparator("a b", "");
+  BOOST_CHECK_EQUAL(*noseparator.begin(), "a b");
+}
+
 BOOST_AUTO_TEST_CASE(wildcmp_test) {
   string wildcard = "";
   string potential_match = "";
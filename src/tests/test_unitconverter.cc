@@ -21,6 +21,7 @@
 
 // Standard includes
 #include <iostream>
+#include <vector>
 
 // Third party includes
 #include <boost/test/unit_test.hpp>
@@ -267,4 +268,41 @@ BOOST_AUTO_TEST_CASE(unitconverter_test_molar_force) {
               force;
   BOOST_CHECK_CLOSE(1E12, force_new, 0.01);
 }
+BOOST_AUTO_TEST_CASE(unitconverter_test_bulk) {
+  UnitConverter converter;
+
+  std::vector<double> distances = {1.0, 2.0, 3.0};
+  converter.convertInPlace(DistanceUnit::nanometers, DistanceUnit::angstroms,
+                           distances.data(), votca::Index(distances.size()));
+  BOOST_CHECK_CLOSE(distances[0], 10.0, 1e-10);
+  BOOST_CHECK_CLOSE(distances[2], 30.0, 1e-10);
+
+  constexpr double factor =
+      UnitConverter::factor<DistanceUnit, DistanceUnit::nanometers,
+                            DistanceUnit::bohr>();
+  BOOST_CHECK_CLOSE(factor, 18.8973, 0.01);
+
+  // large enough to be split in several blocks
+  Eigen::MatrixXd forces = Eigen::MatrixXd::Random(3, 100000);
+  Eigen::MatrixXd ref =
+      forces * converter.convert(ForceUnit::kilojoules_per_nanometer,
+                                 ForceUnit::hatree_per_bohr);
+  converter.convertInPlace<ForceUnit, ForceUnit::kilojoules_per_nanometer,
+                           ForceUnit::hatree_per_bohr>(forces);
+  BOOST_CHECK(ref.isApprox(forces, 1e-12));
+
+  // blocks of contiguous columns are converted in place
+  Eigen::MatrixXd velocities = Eigen::MatrixXd::Ones(3, 4);
+  converter.convertInPlace(VelocityUnit::nanometers_per_picosecond,
+                           VelocityUnit::angstroms_per_picosecond,
+                           velocities.leftCols(2));
+  BOOST_CHECK_CLOSE(velocities(2, 1), 10.0, 1e-10);
+  BOOST_CHECK_CLOSE(velocities(0, 2), 1.0, 1e-10);
+  BOOST_CHECK_THROW(
+      converter.convertInPlace(VelocityUnit::nanometers_per_picosecond,
+                               VelocityUnit::angstroms_per_picosecond,
+                               velocities.row(0)),
+      std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()